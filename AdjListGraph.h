@@ -1,8 +1,9 @@
 #pragma once
 
 #include <vector>
+#include "CSRGraph.h"
 
-template<typename T>
+template<typename T, typename W = int>
 class AdjListGraph
 {
 private:
@@ -15,22 +16,26 @@ private:
 		Vertex(const T& data)
 			: mData(data)
 			, mEdges()
+			, mWeights()
 		{}
 
 		Vertex(const Vertex& other)
 			: mData(other.mData)
 			, mEdges(other.mEdges)
+			, mWeights(other.mWeights)
 		{}
 
 		Vertex(Vertex&& other) noexcept
 			: mData(std::move(other.mData))
 			, mEdges(std::move(other.mEdges))
+			, mWeights(std::move(other.mWeights))
 		{}
 
 		Vertex& operator=(const Vertex& other)
 		{
 			mData = other.mData;
 			mEdges = other.mEdges;
+			mWeights = other.mWeights;
 			return *this;
 		}
 
@@ -38,6 +43,7 @@ private:
 		{
 			mData = std::move(other.mData);
 			mEdges = std::move(other.mEdges);
+			mWeights = std::move(other.mWeights);
 			return *this;
 		}
 
@@ -49,11 +55,13 @@ private:
 	private:
 		T mData;
 		std::vector<Vertex*> mEdges;
+		std::vector<W> mWeights;  // mEdges  ġ  ġ
 	};
 
 public:
 	using size_type = std::vector<Vertex>::size_type;
 	using iterator = std::vector<Vertex>::iterator;
+	using weight_type = W;
 
 	// constructor
 
@@ -156,6 +164,7 @@ public:
 		for (auto& vertex : mVertices)
 		{
 			vertex.mEdges.clear();
+			vertex.mWeights.clear();
 		}
 	}
 
@@ -163,6 +172,7 @@ public:
 	{
 		size_type valueIndex = findIndex(value);
 		mVertices[valueIndex].mEdges.clear();
+		mVertices[valueIndex].mWeights.clear();
 	}
 
 	//   ش    Բ ǳ
@@ -190,6 +200,7 @@ public:
 			auto it = std::find(mVertices[i].mEdges.begin(), mVertices[i].mEdges.end(), &(*eraseIt));
 			if (it != mVertices[i].mEdges.end())
 			{
+				mVertices[i].mWeights.erase(mVertices[i].mWeights.begin() + (it - mVertices[i].mEdges.begin()));
 				mVertices[i].mEdges.erase(it);
 			}
 		}
@@ -214,6 +225,7 @@ public:
 			return;
 		}
 
+		mVertices[fromIndex].mWeights.erase(mVertices[fromIndex].mWeights.begin() + (eraseIt - mVertices[fromIndex].mEdges.begin()));
 		mVertices[fromIndex].mEdges.erase(eraseIt);
 	}
 
@@ -240,6 +252,11 @@ public:
 	}
 
 	inline void link_vertex(const T& from, const T& to)
+	{
+		link_vertex(from, to, W(1));
+	}
+
+	inline void link_vertex(const T& from, const T& to, const W& weight)
 	{
 		size_type fromIndex = findIndex(from);
 		size_type toIndex = findIndex(to);
@@ -250,6 +267,7 @@ public:
 		}
 
 		mVertices[fromIndex].mEdges.push_back(&mVertices[toIndex]);
+		mVertices[fromIndex].mWeights.push_back(weight);
 	}
 
 	inline void unlink_vertex(const T& from, const T& to)
@@ -268,6 +286,7 @@ public:
 			return;
 		}
 
+		mVertices[fromIndex].mWeights.erase(mVertices[fromIndex].mWeights.begin() + (eraseIt - mVertices[fromIndex].mEdges.begin()));
 		mVertices[fromIndex].mEdges.erase(eraseIt);
 	}
 
@@ -290,6 +309,21 @@ public:
 		return false;
 	}
 
+	//  ʾ W()
+	inline W weight(const T& from, const T& to)
+	{
+		size_type fromIndex = findIndex(from);
+		size_type toIndex = findIndex(to);
+
+		auto it = std::find(mVertices[fromIndex].mEdges.begin(), mVertices[fromIndex].mEdges.end(), &mVertices[toIndex]);
+		if (it == mVertices[fromIndex].mEdges.end())
+		{
+			return W();
+		}
+
+		return mVertices[fromIndex].mWeights[it - mVertices[fromIndex].mEdges.begin()];
+	}
+
 	inline void swap(AdjListGraph& other) noexcept
 	{
 		std::swap(mVertices, other.mVertices);
@@ -332,6 +366,34 @@ public:
 		}
 	}
 
+	//   ȣ ű CSR ׷ ȯѴ.
+	//  Ű  ȣ ּ ̷ ϹǷ findIndex  O(V + E).
+	inline CSRGraph<W> to_csr() const
+	{
+		std::vector<typename CSRGraph<W>::offset_type> offsets(mVertices.size() + 1, 0);
+		std::vector<typename CSRGraph<W>::vertex_type> targets;
+		std::vector<W> weights;
+
+		for (size_type i = 0; i < mVertices.size(); i++)
+		{
+			offsets[i + 1] = offsets[i] + mVertices[i].mEdges.size();
+		}
+
+		targets.reserve(offsets.back());
+		weights.reserve(offsets.back());
+		for (const auto& vertex : mVertices)
+		{
+			for (const Vertex* next : vertex.mEdges)
+			{
+				targets.push_back(static_cast<typename CSRGraph<W>::vertex_type>(next - mVertices.data()));
+			}
+
+			weights.insert(weights.end(), vertex.mWeights.begin(), vertex.mWeights.end());
+		}
+
+		return CSRGraph<W>(std::move(offsets), std::move(targets), std::move(weights));
+	}
+
 private:
 	inline size_type findIndex(const T& value)
 	{
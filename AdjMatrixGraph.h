@@ -1,12 +1,16 @@
 #pragma once
 
 #include <vector>
+#include "CSRGraph.h"
+#include "FloydWarshall.h"
 
-template<typename T>
+template<typename T, typename W = int>
 class AdjMatrixGraph
 {
 public:
 	using size_type = std::vector<T>::size_type;
+	using weight_type = W;
+
 	// constructor
 
 	explicit AdjMatrixGraph() = default;
@@ -14,11 +18,13 @@ public:
 	AdjMatrixGraph(const AdjMatrixGraph& other)
 		: mVertices(other.mVertices)
 		, mAdjMat(other.mAdjMat)
+		, mWeightMat(other.mWeightMat)
 	{}
 
 	AdjMatrixGraph(AdjMatrixGraph&& other)
 		: mVertices(std::move(other.mVertices))
 		, mAdjMat(std::move(other.mAdjMat))
+		, mWeightMat(std::move(other.mWeightMat))
 	{}
 
 	//
@@ -35,6 +41,7 @@ public:
 	{
 		mVertices = other.mVertices;
 		mAdjMat = other.mAdjMat;
+		mWeightMat = other.mWeightMat;
 		return *this;
 	}
 
@@ -42,6 +49,7 @@ public:
 	{
 		mVertices = std::move(other.mVertices);
 		mAdjMat = std::move(other.mAdjMat);
+		mWeightMat = std::move(other.mWeightMat);
 		return *this;
 	}
 
@@ -106,6 +114,7 @@ public:
 	{
 		mVertices.clear();
 		mAdjMat.clear();
+		mWeightMat.clear();
 	}
 
 	inline void clear_edges()
@@ -143,6 +152,12 @@ public:
 		{
 			edges.resize(mVertices.size());
 		}
+
+		mWeightMat.resize(mVertices.size());
+		for (auto& weights : mWeightMat)
+		{
+			weights.resize(mVertices.size());
+		}
 	}
 
 	inline void erase_edge(const T& from, const T& to)
@@ -172,6 +187,12 @@ public:
 		{
 			mat.resize(mVertices.size(), false);
 		}
+
+		mWeightMat.push_back(std::vector<W>(mVertices.size(), W()));
+		for (auto& weights : mWeightMat)
+		{
+			weights.resize(mVertices.size(), W());
+		}
 	}
 
 	inline void push_back(const T&& value)
@@ -188,9 +209,20 @@ public:
 		{
 			mat.resize(mVertices.size(), false);
 		}
+
+		mWeightMat.push_back(std::vector<W>(mVertices.size(), W()));
+		for (auto& weights : mWeightMat)
+		{
+			weights.resize(mVertices.size(), W());
+		}
 	}
 
 	inline void link_vertex(const T& from, const T& to)
+	{
+		link_vertex(from, to, W(1));
+	}
+
+	inline void link_vertex(const T& from, const T& to, const W& weight)
 	{
 		size_type fromIndex = findIndex(from);
 		size_type toIndex = findIndex(to);
@@ -201,6 +233,7 @@ public:
 		}
 
 		mAdjMat[fromIndex][toIndex] = true;
+		mWeightMat[fromIndex][toIndex] = weight;
 	}
 
 	inline void unlink_vertex(const T& from, const T& to)
@@ -224,10 +257,68 @@ public:
 		return mAdjMat[fromIndex][toIndex];
 	}
 
+	inline const W& weight(const T& from, const T& to)
+	{
+		size_type fromIndex = findIndex(from);
+		size_type toIndex = findIndex(to);
+
+		return mWeightMat[fromIndex][toIndex];
+	}
+
 	inline void swap(AdjMatrixGraph& other) noexcept
 	{
 		std::swap(mVertices, other.mVertices);
 		std::swap(mAdjMat, other.mAdjMat);
+		std::swap(mWeightMat, other.mWeightMat);
+	}
+
+	//    ִ Ÿ  켱 size() * size() ķ ȯ.
+	// [i * size() + j] : i  j  Ÿ (ΰ  FloydWarshallInfinity<W>())
+	inline std::vector<W> all_pairs_shortest_paths(size_type blockSize = 64, unsigned threadCount = 0) const
+	{
+		const size_type n = mVertices.size();
+		std::vector<W> dist(n * n, FloydWarshallInfinity<W>());
+
+		for (size_type i = 0; i < n; i++)
+		{
+			for (size_type j = 0; j < n; j++)
+			{
+				if (mAdjMat[i][j])
+				{
+					dist[i * n + j] = mWeightMat[i][j];
+				}
+			}
+
+			dist[i * n + i] = W();
+		}
+
+		FloydWarshall(dist, n, blockSize, threadCount);
+		return dist;
+	}
+
+	//   ȣ ű CSR ׷ ȯѴ.
+	inline CSRGraph<W> to_csr() const
+	{
+		const size_type n = mVertices.size();
+		std::vector<typename CSRGraph<W>::offset_type> offsets(n + 1, 0);
+		std::vector<typename CSRGraph<W>::vertex_type> targets;
+		std::vector<W> weights;
+
+		for (size_type i = 0; i < n; i++)
+		{
+			for (size_type j = 0; j < n; j++)
+			{
+				if (mAdjMat[i][j])
+				{
+					targets.push_back(static_cast<typename CSRGraph<W>::vertex_type>(j));
+					weights.push_back(mWeightMat[i][j]);
+				}
+			}
+
+			offsets[i + 1] = targets.size();
+		}
+
+		return CSRGraph<W>(std::move(offsets), std::move(targets), std::move(weights));
 	}
 
 	inline void dfs_search(const T& start)
@@ -295,4 +386,5 @@ private:
 private:
 	std::vector<T> mVertices;
 	std::vector<std::vector<bool>> mAdjMat;
+	std::vector<std::vector<W>> mWeightMat;
 };
\ No newline at end of file
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "CSRGraph.h"
+#include "FloydWarshall.h"
+#include "GraphAlgorithm.h"
+#include "Parallel.h"
+
+//    ִ Ÿ ġũ
+//   ġ ׷  ÷̵-Ȱ     ͽƮ ð 
+//  Ÿ   ȮѴ.     ThreadPool  Ѵ. (ͽƮ  )
+//
+//	AllPairsShortestPathBenchmarkConfig config;
+//	config.vertexCounts = { 1024, 4096 };
+//	PrintAllPairsShortestPathBenchmark(stdout, RunAllPairsShortestPathBenchmark(config));
+//
+//   ̿ density Ȯ   ġ [1, 1000]  .
+// ÷̵- е  O(V^3), ͽƮ V O(V * ElogV) Ҽ ͽƮ ϴ.
+
+struct AllPairsShortestPathBenchmarkConfig
+{
+	std::vector<size_t> vertexCounts = { 512, 1024, 2048 };
+	std::vector<double> densities = { 0.01, 0.1, 0.5 };
+	size_t blockSize = 64;    // FloydWarshall  ũ
+	unsigned repeats = 1;
+	unsigned threadCount = 0; // 0̸ ϵ  
+	uint64_t seed = 1;
+};
+
+struct AllPairsShortestPathBenchmarkResult
+{
+	std::string algorithm;
+	size_t vertices = 0;
+	size_t edges = 0;
+	double density = 0;
+	double milliseconds = 0; // ݺ  ߾Ӱ
+	bool consistent = false; //   Ÿ  
+};
+
+//  ÷̵-Ȱ ͽƮ V .
+inline void MeasureAllPairsShortestPath(ThreadPool& pool, size_t n, double density,
+	const AllPairsShortestPathBenchmarkConfig& config, std::vector<AllPairsShortestPathBenchmarkResult>& results)
+{
+	const int inf = FloydWarshallInfinity<int>();
+
+	std::mt19937_64 rng(config.seed + n);
+	std::bernoulli_distribution coin(density);
+	std::uniform_int_distribution<int> weight(1, 1000);
+
+	std::vector<WeightedEdge<int>> edges;
+	std::vector<int> initial(n * n, inf);
+
+	for (size_t u = 0; u < n; u++)
+	{
+		initial[u * n + u] = 0;
+
+		for (size_t v = 0; v < n; v++)
+		{
+			if (u != v && coin(rng))
+			{
+				const int w = weight(rng);
+				edges.push_back(WeightedEdge<int>{ static_cast<int>(u), static_cast<int>(v), w });
+				initial[u * n + v] = w;
+			}
+		}
+	}
+
+	const CSRGraph<int> g(n, edges);
+
+	std::vector<int> floyd;
+	std::vector<int> dijkstra(n * n);
+
+	auto measure = [&](const char* name, auto run)
+	{
+		std::vector<double> times;
+
+		for (unsigned r = 0; r < std::max(config.repeats, 1u); r++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			run();
+			times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+
+		std::sort(times.begin(), times.end());
+
+		AllPairsShortestPathBenchmarkResult result;
+		result.algorithm = name;
+		result.vertices = n;
+		result.edges = edges.size();
+		result.density = density;
+		result.milliseconds = times[times.size() / 2];
+		results.push_back(result);
+	};
+
+	const size_t first = results.size();
+
+	measure("FloydWarshall", [&]()
+		{
+			floyd = initial;
+			FloydWarshall(pool, floyd, n, config.blockSize);
+		});
+
+	measure("Dijkstra x V", [&]()
+		{
+			ParallelFor(pool, 0, n, [&](size_t begin, size_t end)
+				{
+					for (size_t s = begin; s < end; s++)
+					{
+						std::vector<int> row = Dijkstra(g, static_cast<int>(s), inf);
+						std::copy(row.begin(), row.end(), dijkstra.begin() + s * n);
+					}
+				});
+		});
+
+	const bool consistent = floyd == dijkstra;
+
+	for (size_t i = first; i < results.size(); i++)
+	{
+		results[i].consistent = consistent;
+	}
+}
+
+inline std::vector<AllPairsShortestPathBenchmarkResult> RunAllPairsShortestPathBenchmark(
+	const AllPairsShortestPathBenchmarkConfig& config = AllPairsShortestPathBenchmarkConfig())
+{
+	ThreadPool pool(config.threadCount);
+	std::vector<AllPairsShortestPathBenchmarkResult> results;
+
+	for (size_t n : config.vertexCounts)
+	{
+		for (double density : config.densities)
+		{
+			MeasureAllPairsShortestPath(pool, n, density, config, results);
+		}
+	}
+
+	return results;
+}
+
+//   ǥ
+inline void PrintAllPairsShortestPathBenchmark(FILE* file, const std::vector<AllPairsShortestPathBenchmarkResult>& results)
+{
+	fprintf(file, "%-14s %10s %12s %8s %10s %s\n", "algorithm", "vertices", "edges", "density", "ms", "ok");
+
+	for (const AllPairsShortestPathBenchmarkResult& r : results)
+	{
+		fprintf(file, "%-14s %10zu %12zu %8.3f %10.2f %s\n",
+			r.algorithm.c_str(), r.vertices, r.edges, r.density, r.milliseconds,
+			r.consistent ? "ok" : "FAIL");
+	}
+}
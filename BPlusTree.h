@@ -0,0 +1,936 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "NodePool.h"
+
+// B+ Ʈ
+//  忡 Ű   ־ Ʈ ̸ .  Ʈ Ž  ܰ踶 ĳ ̽ 
+// B+ Ʈ   (  ĳ ) а  ȿ Ű ã    .
+// -   忡 ְ,   Ű ڽĸ .  尡 ۾   ܰ ĳÿ ´.
+// -   Ű , ڽİ   迭 д. , Ǽ Ű std::less ϸ
+//   Ű ŭ   ϴ б   Ž  Ϸ SIMD ´.
+//     Ű б   Ž .
+// -    Ǿ  ȸ  ʷ д´.
+// - ĵ Է¿ O(N)     ִ. (build_from_sorted)
+//
+// Ű ߺ ʴ ĵ . Ű  ⺻  ̵ ؾ Ѵ.
+// Ű   ǹǷ ݺڴ pair  key(), value() д´.
+// ,  Ҹ  ̷ űǷ  ݺڸ ȿȭѴ.
+//
+// NodeBytes  ϳ ǥ ũ.  Ű  ⼭ . (ĳ  64Ʈ )
+// ⺻ 512 int Ű  , Ž   ũ.
+//
+//   Ű k[0] < k[1] < ...   ڽ i Ű  (k[i-1], k[i]]  ִ.
+// ׷  忡 "key  Ű "  ڽ̳   ġ ȴ.
+template<typename Key, typename Value, typename Compare = std::less<Key>, size_t NodeBytes = 512>
+class BPlusTree
+{
+private:
+	struct Node
+	{
+		uint32_t count = 0; // Ű 
+	};
+
+	static constexpr size_t LeafCapacity = std::max<size_t>(4,
+		(NodeBytes - sizeof(Node) - 2 * sizeof(void*)) / (sizeof(Key) + sizeof(Value)));
+
+	static constexpr size_t InnerCapacity = std::max<size_t>(4,
+		(NodeBytes - sizeof(Node) - sizeof(void*)) / (sizeof(Key) + sizeof(void*)));
+
+	// Ʈ ƴ 尡  ϴ ּ Ű 
+	static constexpr size_t LeafMinimum = LeafCapacity / 2;
+	static constexpr size_t InnerMinimum = InnerCapacity / 2;
+
+	struct alignas(64) LeafNode : Node
+	{
+		Key keys[LeafCapacity];
+		Value values[LeafCapacity];
+		LeafNode* prev = nullptr;
+		LeafNode* next = nullptr;
+	};
+
+	struct alignas(64) InnerNode : Node
+	{
+		Key keys[InnerCapacity];
+		Node* children[InnerCapacity + 1] = {};
+	};
+
+	//   (   ȿ  ڽ ȣ)
+	struct PathEntry
+	{
+		InnerNode* node;
+		size_t index;
+	};
+
+	static constexpr bool LinearSearch = std::is_arithmetic_v<Key>
+		&& (std::is_same_v<Compare, std::less<Key>> || std::is_same_v<Compare, std::less<>>);
+
+	class Iterator
+	{
+	public:
+		friend class BPlusTree;
+
+		using iterator_category = std::bidirectional_iterator_tag;
+		using difference_type = ptrdiff_t;
+
+	public:
+		Iterator()
+			: mTree(nullptr)
+			, mLeaf(nullptr)
+			, mIndex(0)
+		{}
+
+		Iterator(const BPlusTree* tree, LeafNode* leaf, size_t index)
+			: mTree(tree)
+			, mLeaf(leaf)
+			, mIndex(index)
+		{}
+
+		inline const Key& key() const
+		{
+			return mLeaf->keys[mIndex];
+		}
+
+		inline Value& value() const
+		{
+			return mLeaf->values[mIndex];
+		}
+
+		Iterator& operator++()
+		{
+			if (++mIndex == mLeaf->count)
+			{
+				mLeaf = mLeaf->next;
+				mIndex = 0;
+			}
+
+			return *this;
+		}
+
+		Iterator operator++(int)
+		{
+			Iterator temp = *this;
+			++(*this);
+			return temp;
+		}
+
+		// end()   
+		Iterator& operator--()
+		{
+			if (mLeaf == nullptr)
+			{
+				mLeaf = mTree->mLast;
+				mIndex = mLeaf->count - 1;
+			}
+			else if (mIndex == 0)
+			{
+				mLeaf = mLeaf->prev;
+				mIndex = mLeaf->count - 1;
+			}
+			else
+			{
+				--mIndex;
+			}
+
+			return *this;
+		}
+
+		Iterator operator--(int)
+		{
+			Iterator temp = *this;
+			--(*this);
+			return temp;
+		}
+
+		bool operator==(const Iterator& other) const noexcept
+		{
+			return mLeaf == other.mLeaf && mIndex == other.mIndex;
+		}
+
+		bool operator!=(const Iterator& other) const noexcept
+		{
+			return (*this == other) == false;
+		}
+
+	private:
+		const BPlusTree* mTree;
+		LeafNode* mLeaf; // end() nullptr
+		size_t mIndex;
+	};
+
+public:
+	using iterator = Iterator;
+
+	// constructor
+
+	explicit BPlusTree(const Compare& comp = Compare())
+		: mCompare(comp)
+	{}
+
+	BPlusTree(const BPlusTree&) = delete;
+	BPlusTree& operator=(const BPlusTree&) = delete;
+
+	BPlusTree(BPlusTree&& other) noexcept
+		: mCompare(other.mCompare)
+	{
+		swap(other);
+	}
+
+	BPlusTree& operator=(BPlusTree&& other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
+	//
+
+	// destructor
+
+	~BPlusTree()
+	{
+		clear();
+	}
+
+	//
+
+	// Iterators
+
+	inline iterator begin() const noexcept
+	{
+		return iterator(this, mFirst, 0);
+	}
+
+	inline iterator end() const noexcept
+	{
+		return iterator(this, nullptr, 0);
+	}
+
+	//
+
+	// Capacity
+
+	inline bool empty() const noexcept
+	{
+		return mSize == 0;
+	}
+
+	inline size_t size() const noexcept
+	{
+		return mSize;
+	}
+
+	// Ʈ ٱ   
+	inline size_t height() const noexcept
+	{
+		return mHeight;
+	}
+
+	static constexpr size_t leaf_capacity()
+	{
+		return LeafCapacity;
+	}
+
+	static constexpr size_t inner_capacity()
+	{
+		return InnerCapacity;
+	}
+
+	//
+
+	// Lookup
+
+	iterator find(const Key& key) const
+	{
+		iterator it = lower_bound(key);
+
+		if (it.mLeaf != nullptr && mCompare(key, it.key()) == false)
+		{
+			return it;
+		}
+
+		return end();
+	}
+
+	inline bool contains(const Key& key) const
+	{
+		return find(key) != end();
+	}
+
+	// key ̻ ù 
+	iterator lower_bound(const Key& key) const
+	{
+		if (mRoot == nullptr)
+		{
+			return end();
+		}
+
+		Node* node = mRoot;
+
+		for (size_t level = 0; level < mHeight; level++)
+		{
+			InnerNode* inner = static_cast<InnerNode*>(node);
+			node = inner->children[LowerBoundInNode(inner->keys, inner->count, key)];
+		}
+
+		LeafNode* leaf = static_cast<LeafNode*>(node);
+		size_t index = LowerBoundInNode(leaf->keys, leaf->count, key);
+
+		//   Ű  ִ񰪺 Ŭ  ־ ( )      ó̴.
+		if (index == leaf->count)
+		{
+			return iterator(this, leaf->next, 0);
+		}
+
+		return iterator(this, leaf, index);
+	}
+
+	// key ū ù 
+	iterator upper_bound(const Key& key) const
+	{
+		iterator it = lower_bound(key);
+
+		if (it.mLeaf != nullptr && mCompare(key, it.key()) == false)
+		{
+			++it;
+		}
+
+		return it;
+	}
+
+	//
+
+	// Modifiers
+
+	// ̹ ִ Ű  ʰ  Ҹ ش.
+	template<typename K, typename V>
+	std::pair<iterator, bool> insert(K&& key, V&& value)
+	{
+		if (mRoot == nullptr)
+		{
+			LeafNode* leaf = createLeaf();
+			mRoot = leaf;
+			mFirst = leaf;
+			mLast = leaf;
+		}
+
+		PathEntry path[MaxHeight];
+		LeafNode* leaf = descend(key, path);
+		size_t index = LowerBoundInNode(leaf->keys, leaf->count, key);
+
+		if (index < leaf->count && mCompare(key, leaf->keys[index]) == false)
+		{
+			return { iterator(this, leaf, index), false };
+		}
+
+		if (leaf->count == LeafCapacity)
+		{
+			//       ű,   .
+			//    ڸ (index == leaf->count) θ Ű ũǷ   ó ִ´.
+			LeafNode* right = splitLeaf(leaf, path);
+
+			if (index >= leaf->count)
+			{
+				index -= leaf->count;
+				leaf = right;
+			}
+		}
+
+		insertIntoLeaf(leaf, index, std::forward<K>(key), std::forward<V>(value));
+		mSize++;
+
+		return { iterator(this, leaf, index), true };
+	}
+
+	//  Value() ִ´.
+	Value& operator[](const Key& key)
+	{
+		return insert(key, Value()).first.value();
+	}
+
+	size_t erase(const Key& key)
+	{
+		if (mRoot == nullptr)
+		{
+			return 0;
+		}
+
+		PathEntry path[MaxHeight];
+		LeafNode* leaf = descend(key, path);
+		size_t index = LowerBoundInNode(leaf->keys, leaf->count, key);
+
+		if (index == leaf->count || mCompare(key, leaf->keys[index]))
+		{
+			return 0;
+		}
+
+		std::move(leaf->keys + index + 1, leaf->keys + leaf->count, leaf->keys + index);
+		std::move(leaf->values + index + 1, leaf->values + leaf->count, leaf->values + index);
+		leaf->count--;
+		mSize--;
+
+		if (mHeight == 0)
+		{
+			if (leaf->count == 0)
+			{
+				destroyLeaf(leaf);
+				mRoot = nullptr;
+				mFirst = nullptr;
+				mLast = nullptr;
+			}
+
+			return 1;
+		}
+
+		if (leaf->count < LeafMinimum)
+		{
+			rebalanceLeaf(leaf, path);
+		}
+
+		return 1;
+	}
+
+	//    Ҹ ش.
+	iterator erase(iterator pos)
+	{
+		assert(pos.mLeaf != nullptr);
+
+		iterator next = pos;
+		++next;
+
+		if (next == end())
+		{
+			erase(Key(pos.key()));
+			return end();
+		}
+
+		Key nextKey = next.key();
+		erase(Key(pos.key()));
+
+		return lower_bound(nextKey);
+	}
+
+	void clear() noexcept
+	{
+		if (mRoot != nullptr)
+		{
+			if constexpr (std::is_trivially_destructible_v<Key> == false || std::is_trivially_destructible_v<Value> == false)
+			{
+				destroyValues(mRoot, mHeight);
+			}
+		}
+
+		mLeafPool.release();
+		mInnerPool.release();
+		mRoot = nullptr;
+		mFirst = nullptr;
+		mLast = nullptr;
+		mSize = 0;
+		mHeight = 0;
+	}
+
+	// ĵǾ ְ Ű ߺ ʴ (first, second)   Ʈ  . O(N)
+	//  Ʒ ä   ܰ踦 ʷ .  尡 ּ Ű  ۾ ʵ
+	//  ܰ Ҹ    .   äǷ   ٸ  .
+	template<typename ForwardIt>
+	void build_from_sorted(ForwardIt first, ForwardIt last)
+	{
+		clear();
+
+		const size_t n = static_cast<size_t>(std::distance(first, last));
+		if (n == 0)
+		{
+			return;
+		}
+
+		// (,  Ʈ  ū Ű)
+		std::vector<std::pair<Node*, Key>> level;
+
+		const size_t leafCount = (n + LeafCapacity - 1) / LeafCapacity;
+		LeafNode* prev = nullptr;
+
+		for (size_t i = 0; i < leafCount; i++)
+		{
+			const size_t count = n / leafCount + (i < n % leafCount ? 1 : 0);
+			LeafNode* leaf = createLeaf();
+
+			for (size_t j = 0; j < count; j++, ++first)
+			{
+				assert(j == 0 || mCompare(leaf->keys[j - 1], (*first).first));
+				leaf->keys[j] = (*first).first;
+				leaf->values[j] = (*first).second;
+			}
+
+			leaf->count = static_cast<uint32_t>(count);
+			leaf->prev = prev;
+
+			if (prev != nullptr)
+			{
+				prev->next = leaf;
+			}
+			else
+			{
+				mFirst = leaf;
+			}
+
+			prev = leaf;
+			level.push_back({ leaf, leaf->keys[count - 1] });
+		}
+
+		mLast = prev;
+		mSize = n;
+
+		while (level.size() > 1)
+		{
+			const size_t childCount = level.size();
+			const size_t nodeCount = (childCount + InnerCapacity) / (InnerCapacity + 1);
+			std::vector<std::pair<Node*, Key>> upper;
+			size_t child = 0;
+
+			for (size_t i = 0; i < nodeCount; i++)
+			{
+				const size_t count = childCount / nodeCount + (i < childCount % nodeCount ? 1 : 0);
+				InnerNode* inner = createInner();
+
+				for (size_t j = 0; j < count; j++, child++)
+				{
+					inner->children[j] = level[child].first;
+
+					if (j + 1 < count)
+					{
+						inner->keys[j] = level[child].second;
+					}
+				}
+
+				inner->count = static_cast<uint32_t>(count - 1);
+				upper.push_back({ inner, level[child - 1].second });
+			}
+
+			level = std::move(upper);
+			mHeight++;
+		}
+
+		mRoot = level.front().first;
+	}
+
+	void swap(BPlusTree& other) noexcept
+	{
+		std::swap(mCompare, other.mCompare);
+		mLeafPool.swap(other.mLeafPool);
+		mInnerPool.swap(other.mInnerPool);
+		std::swap(mRoot, other.mRoot);
+		std::swap(mFirst, other.mFirst);
+		std::swap(mLast, other.mLast);
+		std::swap(mSize, other.mSize);
+		std::swap(mHeight, other.mHeight);
+	}
+
+	//
+
+private:
+	// 帶 ּ  Ƿ Ű  2^64  ̺  ʴ´.
+	static constexpr size_t MaxHeight = 64;
+
+	// keys[0, count) key  Ű 
+	size_t LowerBoundInNode(const Key* keys, size_t count, const Key& key) const
+	{
+		if constexpr (LinearSearch)
+		{
+			//   ϱ⸸ ϹǷ бⰡ  ݺ ̿   SIMD δ.
+			size_t result = 0;
+
+			for (size_t i = 0; i < count; i++)
+			{
+				result += keys[i] < key ? 1 : 0;
+			}
+
+			return result;
+		}
+		else
+		{
+			// б   Ž.  ̴ Ƚ countθ .
+			if (count == 0)
+			{
+				return 0;
+			}
+
+			const Key* base = keys;
+
+			while (count > 1)
+			{
+				const size_t half = count / 2;
+				base = mCompare(base[half], key) ? base + half : base;
+				count -= half;
+			}
+
+			return (base - keys) + (mCompare(*base, key) ? 1 : 0);
+		}
+	}
+
+	// Ʈ key  ٱ  θ path .
+	LeafNode* descend(const Key& key, PathEntry* path) const
+	{
+		Node* node = mRoot;
+
+		for (size_t level = 0; level < mHeight; level++)
+		{
+			InnerNode* inner = static_cast<InnerNode*>(node);
+			size_t index = LowerBoundInNode(inner->keys, inner->count, key);
+
+			path[level] = { inner, index };
+			node = inner->children[index];
+		}
+
+		return static_cast<LeafNode*>(node);
+	}
+
+	template<typename K, typename V>
+	static void insertIntoLeaf(LeafNode* leaf, size_t index, K&& key, V&& value)
+	{
+		std::move_backward(leaf->keys + index, leaf->keys + leaf->count, leaf->keys + leaf->count + 1);
+		std::move_backward(leaf->values + index, leaf->values + leaf->count, leaf->values + leaf->count + 1);
+
+		leaf->keys[index] = std::forward<K>(key);
+		leaf->values[index] = std::forward<V>(value);
+		leaf->count++;
+	}
+
+	//        ű θ   ִ´.
+	LeafNode* splitLeaf(LeafNode* leaf, PathEntry* path)
+	{
+		LeafNode* right = createLeaf();
+		const size_t keep = (LeafCapacity + 1) / 2;
+
+		std::move(leaf->keys + keep, leaf->keys + leaf->count, right->keys);
+		std::move(leaf->values + keep, leaf->values + leaf->count, right->values);
+		right->count = leaf->count - static_cast<uint32_t>(keep);
+		leaf->count = static_cast<uint32_t>(keep);
+
+		right->prev = leaf;
+		right->next = leaf->next;
+
+		if (leaf->next != nullptr)
+		{
+			leaf->next->prev = right;
+		}
+		else
+		{
+			mLast = right;
+		}
+
+		leaf->next = right;
+
+		insertIntoParent(leaf, leaf->keys[keep - 1], right, path, mHeight);
+		return right;
+	}
+
+	// left ٷ ʿ right Ŵܴ. separator left   ū Ű
+	// level left ִ  (path[level - 1] θ)
+	void insertIntoParent(Node* left, const Key& separator, Node* right, PathEntry* path, size_t level)
+	{
+		if (level == 0)
+		{
+			// Ʈ .
+			InnerNode* root = createInner();
+			root->keys[0] = separator;
+			root->children[0] = left;
+			root->children[1] = right;
+			root->count = 1;
+
+			mRoot = root;
+			mHeight++;
+			return;
+		}
+
+		InnerNode* parent = path[level - 1].node;
+		size_t index = path[level - 1].index;
+
+		if (parent->count < InnerCapacity)
+		{
+			insertIntoInner(parent, index, separator, right);
+			return;
+		}
+
+		// θ  á. Ű InnerCapacity + 1   Ű  ܰ  ø.
+		Key keys[InnerCapacity + 1];
+		Node* children[InnerCapacity + 2];
+
+		std::move(parent->keys, parent->keys + index, keys);
+		keys[index] = separator;
+		std::move(parent->keys + index, parent->keys + parent->count, keys + index + 1);
+
+		std::copy(parent->children, parent->children + index + 1, children);
+		children[index + 1] = right;
+		std::copy(parent->children + index + 1, parent->children + parent->count + 1, children + index + 2);
+
+		const size_t total = InnerCapacity + 1;
+		const size_t leftCount = total / 2;
+
+		InnerNode* sibling = createInner();
+
+		std::move(keys, keys + leftCount, parent->keys);
+		std::copy(children, children + leftCount + 1, parent->children);
+		parent->count = static_cast<uint32_t>(leftCount);
+
+		const size_t rightCount = total - leftCount - 1;
+		std::move(keys + leftCount + 1, keys + total, sibling->keys);
+		std::copy(children + leftCount + 1, children + total + 1, sibling->children);
+		sibling->count = static_cast<uint32_t>(rightCount);
+
+		insertIntoParent(parent, keys[leftCount], sibling, path, level - 1);
+	}
+
+	// keys[index] separator, children[index + 1] right .
+	static void insertIntoInner(InnerNode* node, size_t index, const Key& separator, Node* right)
+	{
+		std::move_backward(node->keys + index, node->keys + node->count, node->keys + node->count + 1);
+		std::move_backward(node->children + index + 1, node->children + node->count + 1, node->children + node->count + 2);
+
+		node->keys[index] = separator;
+		node->children[index + 1] = right;
+		node->count++;
+	}
+
+	// keys[index] children[index + 1] .
+	static void removeFromInner(InnerNode* node, size_t index)
+	{
+		std::move(node->keys + index + 1, node->keys + node->count, node->keys + index);
+		std::copy(node->children + index + 2, node->children + node->count + 1, node->children + index + 1);
+		node->count--;
+	}
+
+	// Ű ڶ  Լ ϳ ų  ģ.
+	void rebalanceLeaf(LeafNode* leaf, PathEntry* path)
+	{
+		InnerNode* parent = path[mHeight - 1].node;
+		const size_t index = path[mHeight - 1].index;
+
+		LeafNode* left = index > 0 ? static_cast<LeafNode*>(parent->children[index - 1]) : nullptr;
+		LeafNode* right = index < parent->count ? static_cast<LeafNode*>(parent->children[index + 1]) : nullptr;
+
+		if (left != nullptr && left->count > LeafMinimum)
+		{
+			//    Ҹ  
+			insertIntoLeaf(leaf, 0, std::move(left->keys[left->count - 1]), std::move(left->values[left->count - 1]));
+			left->count--;
+			parent->keys[index - 1] = left->keys[left->count - 1];
+			return;
+		}
+
+		if (right != nullptr && right->count > LeafMinimum)
+		{
+			//   ù Ҹ  ڷ
+			leaf->keys[leaf->count] = std::move(right->keys[0]);
+			leaf->values[leaf->count] = std::move(right->values[0]);
+			leaf->count++;
+
+			std::move(right->keys + 1, right->keys + right->count, right->keys);
+			std::move(right->values + 1, right->values + right->count, right->values);
+			right->count--;
+
+			parent->keys[index] = leaf->keys[leaf->count - 1];
+			return;
+		}
+
+		//    ģ.   Ű   LeafCapacity 
+		if (left != nullptr)
+		{
+			mergeLeaves(left, leaf);
+			removeFromInner(parent, index - 1);
+		}
+		else
+		{
+			mergeLeaves(leaf, right);
+			removeFromInner(parent, index);
+		}
+
+		rebalanceInner(path, mHeight - 1);
+	}
+
+	// right Ҹ left ڿ ̰ right ش.
+	void mergeLeaves(LeafNode* left, LeafNode* right)
+	{
+		std::move(right->keys, right->keys + right->count, left->keys + left->count);
+		std::move(right->values, right->values + right->count, left->values + left->count);
+		left->count += right->count;
+
+		left->next = right->next;
+
+		if (right->next != nullptr)
+		{
+			right->next->prev = left;
+		}
+		else
+		{
+			mLast = left;
+		}
+
+		destroyLeaf(right);
+	}
+
+	// path[level]  忡 ڽ ϳ . ڶ Լ ų ģ.
+	void rebalanceInner(PathEntry* path, size_t level)
+	{
+		InnerNode* node = path[level].node;
+
+		if (level == 0)
+		{
+			// Ʈ Ű  ϳ  ڽ Ʈ ȴ.
+			if (node->count == 0)
+			{
+				mRoot = node->children[0];
+				mHeight--;
+				destroyInner(node);
+			}
+
+			return;
+		}
+
+		if (node->count >= InnerMinimum)
+		{
+			return;
+		}
+
+		InnerNode* parent = path[level - 1].node;
+		const size_t index = path[level - 1].index;
+
+		InnerNode* left = index > 0 ? static_cast<InnerNode*>(parent->children[index - 1]) : nullptr;
+		InnerNode* right = index < parent->count ? static_cast<InnerNode*>(parent->children[index + 1]) : nullptr;
+
+		if (left != nullptr && left->count > InnerMinimum)
+		{
+			// θ Ű ް,    Ű θ ø.
+			std::move_backward(node->keys, node->keys + node->count, node->keys + node->count + 1);
+			std::copy_backward(node->children, node->children + node->count + 1, node->children + node->count + 2);
+
+			node->keys[0] = std::move(parent->keys[index - 1]);
+			node->children[0] = left->children[left->count];
+			node->count++;
+
+			parent->keys[index - 1] = std::move(left->keys[left->count - 1]);
+			left->count--;
+			return;
+		}
+
+		if (right != nullptr && right->count > InnerMinimum)
+		{
+			// θ Ű ް,   ù Ű θ ø.
+			node->keys[node->count] = std::move(parent->keys[index]);
+			node->children[node->count + 1] = right->children[0];
+			node->count++;
+
+			parent->keys[index] = std::move(right->keys[0]);
+
+			std::move(right->keys + 1, right->keys + right->count, right->keys);
+			std::copy(right->children + 1, right->children + right->count + 1, right->children);
+			right->count--;
+			return;
+		}
+
+		if (left != nullptr)
+		{
+			mergeInner(left, std::move(parent->keys[index - 1]), node);
+			removeFromInner(parent, index - 1);
+		}
+		else
+		{
+			mergeInner(node, std::move(parent->keys[index]), right);
+			removeFromInner(parent, index);
+		}
+
+		rebalanceInner(path, level - 1);
+	}
+
+	// left, θ𿡼  separator, right  ġ right ش.
+	void mergeInner(InnerNode* left, Key&& separator, InnerNode* right)
+	{
+		left->keys[left->count] = std::move(separator);
+		std::move(right->keys, right->keys + right->count, left->keys + left->count + 1);
+		std::copy(right->children, right->children + right->count + 1, left->children + left->count + 1);
+		left->count += right->count + 1;
+
+		destroyInner(right);
+	}
+
+	LeafNode* createLeaf()
+	{
+		LeafNode* leaf = mLeafPool.allocate();
+
+		try
+		{
+			::new (static_cast<void*>(leaf)) LeafNode();
+		}
+		catch (...)
+		{
+			mLeafPool.deallocate(leaf);
+			throw;
+		}
+
+		return leaf;
+	}
+
+	InnerNode* createInner()
+	{
+		InnerNode* inner = mInnerPool.allocate();
+
+		try
+		{
+			::new (static_cast<void*>(inner)) InnerNode();
+		}
+		catch (...)
+		{
+			mInnerPool.deallocate(inner);
+			throw;
+		}
+
+		return inner;
+	}
+
+	void destroyLeaf(LeafNode* leaf)
+	{
+		leaf->~LeafNode();
+		mLeafPool.deallocate(leaf);
+	}
+
+	void destroyInner(InnerNode* inner)
+	{
+		inner->~InnerNode();
+		mInnerPool.deallocate(inner);
+	}
+
+	// ޸𸮴  ʴ´. (clear Ǯ° ش)
+	void destroyValues(Node* node, size_t height)
+	{
+		if (height == 0)
+		{
+			static_cast<LeafNode*>(node)->~LeafNode();
+			return;
+		}
+
+		InnerNode* inner = static_cast<InnerNode*>(node);
+
+		for (size_t i = 0; i <= inner->count; i++)
+		{
+			destroyValues(inner->children[i], height - 1);
+		}
+
+		inner->~InnerNode();
+	}
+
+private:
+	Compare mCompare;
+	NodePool<LeafNode> mLeafPool;
+	NodePool<InnerNode> mInnerPool;
+	Node* mRoot = nullptr;
+	LeafNode* mFirst = nullptr; //    (begin)
+	LeafNode* mLast = nullptr;  //    (--end)
+	size_t mSize = 0;
+	size_t mHeight = 0;
+};
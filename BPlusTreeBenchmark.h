@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BPlusTree.h"
+#include "RedBlackTree.h"
+
+// B+ Ʈ ġũ
+//  Ű BPlusTree RedBlackTree ֱ, ã, ü ȸ,  ȸ, ĵ Է¿ ⸦ 
+//    (checksum)  ȮѴ.
+//
+//	BPlusTreeBenchmarkConfig config;
+//	config.sizes = { 1 << 20 };
+//	PrintBPlusTreeBenchmark(stdout, RunBPlusTreeBenchmark(config));
+//
+// Ű ߺ   uint32_t̰   . ã  Ű    ã´.
+//  ȸ  Ű  rangeLength д´.
+// ð  ϳ ns (ֱ, ã  ϳ)
+
+struct BPlusTreeBenchmarkConfig
+{
+	std::vector<size_t> sizes = { 1 << 16, 1 << 20, 1 << 22 };
+	size_t rangeQueries = 1 << 16;
+	size_t rangeLength = 100;
+	uint64_t seed = 1;
+};
+
+struct BPlusTreeBenchmarkResult
+{
+	std::string structure;
+	std::string operation;   // insert, find, scan, range, bulk load
+	size_t size = 0;
+	double nsPerElement = 0;
+	uint64_t checksum = 0;   // ãų    (ֱ,   )
+	bool consistent = false; //   checksum 
+};
+
+struct BPlusTreeBenchmarkInput
+{
+	std::vector<uint32_t> keys;                        // ִ 
+	std::vector<uint32_t> lookups;                     // ã 
+	std::vector<uint32_t> rangeStarts;
+	std::vector<std::pair<uint32_t, uint32_t>> sorted; // (Ű, ) Ű 
+};
+
+inline BPlusTreeBenchmarkInput GenerateBPlusTreeBenchmarkInput(size_t n, const BPlusTreeBenchmarkConfig& config)
+{
+	std::mt19937_64 rng(config.seed + n);
+	BPlusTreeBenchmarkInput input;
+
+	// Ȧ ϴ  2^32 ϴ̶ Ű ġ ʴ´.
+	input.keys.resize(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		input.keys[i] = static_cast<uint32_t>((i + 1) * 2654435761u);
+	}
+
+	input.lookups = input.keys;
+	std::shuffle(input.lookups.begin(), input.lookups.end(), rng);
+
+	input.rangeStarts.resize(config.rangeQueries);
+	for (uint32_t& start : input.rangeStarts)
+	{
+		start = static_cast<uint32_t>(rng());
+	}
+
+	input.sorted.resize(n);
+	for (size_t i = 0; i < n; i++)
+	{
+		input.sorted[i] = { input.keys[i], static_cast<uint32_t>(i) };
+	}
+
+	std::sort(input.sorted.begin(), input.sorted.end());
+	return input;
+}
+
+//   . insert(tree, key, value) ְ valueOf(iterator)  д´.
+template<typename Tree, typename Insert, typename ValueOf>
+void MeasureBPlusTreeBenchmark(const char* name, const BPlusTreeBenchmarkInput& input, size_t rangeLength,
+	std::vector<BPlusTreeBenchmarkResult>& results, Insert insert, ValueOf valueOf)
+{
+	using Clock = std::chrono::steady_clock;
+
+	auto record = [&](const char* operation, Clock::time_point start, size_t count, uint64_t checksum)
+	{
+		BPlusTreeBenchmarkResult result;
+		result.structure = name;
+		result.operation = operation;
+		result.size = input.keys.size();
+		result.nsPerElement = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / std::max<size_t>(count, 1);
+		result.checksum = checksum;
+		results.push_back(result);
+	};
+
+	Tree tree;
+
+	auto start = Clock::now();
+	for (size_t i = 0; i < input.keys.size(); i++)
+	{
+		insert(tree, input.keys[i], static_cast<uint32_t>(i));
+	}
+	record("insert", start, input.keys.size(), tree.size());
+
+	uint64_t sum = 0;
+	start = Clock::now();
+	for (uint32_t key : input.lookups)
+	{
+		auto it = tree.find(key);
+		sum += (it != tree.end()) ? valueOf(it) : 0;
+	}
+	record("find", start, input.lookups.size(), sum);
+
+	sum = 0;
+	start = Clock::now();
+	for (auto it = tree.begin(); it != tree.end(); ++it)
+	{
+		sum += valueOf(it);
+	}
+	record("scan", start, tree.size(), sum);
+
+	sum = 0;
+	size_t visited = 0;
+	start = Clock::now();
+	for (uint32_t lo : input.rangeStarts)
+	{
+		auto it = tree.lower_bound(lo);
+		for (size_t j = 0; j < rangeLength && it != tree.end(); j++, ++it)
+		{
+			sum += valueOf(it);
+			visited++;
+		}
+	}
+	record("range", start, visited, sum);
+
+	Tree bulk;
+	start = Clock::now();
+	bulk.build_from_sorted(input.sorted.begin(), input.sorted.end());
+	record("bulk load", start, input.sorted.size(), bulk.size());
+}
+
+inline std::vector<BPlusTreeBenchmarkResult> RunBPlusTreeBenchmark(const BPlusTreeBenchmarkConfig& config = BPlusTreeBenchmarkConfig())
+{
+	std::vector<BPlusTreeBenchmarkResult> results;
+
+	for (size_t n : config.sizes)
+	{
+		const BPlusTreeBenchmarkInput input = GenerateBPlusTreeBenchmarkInput(n, config);
+		const size_t first = results.size();
+
+		MeasureBPlusTreeBenchmark<BPlusTree<uint32_t, uint32_t>>("b+ tree", input, config.rangeLength, results,
+			[](auto& tree, uint32_t key, uint32_t value) { tree.insert(key, value); },
+			[](const auto& it) { return it.value(); });
+
+		MeasureBPlusTreeBenchmark<RedBlackTree<uint32_t, uint32_t>>("rb tree", input, config.rangeLength, results,
+			[](auto& tree, uint32_t key, uint32_t value) { tree.try_emplace(key, value); },
+			[](const auto& it) { return it->second; });
+
+		//    곢 Ѵ.
+		const size_t operations = (results.size() - first) / 2;
+		for (size_t i = 0; i < operations; i++)
+		{
+			BPlusTreeBenchmarkResult& a = results[first + i];
+			BPlusTreeBenchmarkResult& b = results[first + operations + i];
+			a.consistent = b.consistent = a.checksum == b.checksum;
+		}
+	}
+
+	return results;
+}
+
+//   ǥ
+inline void PrintBPlusTreeBenchmark(FILE* file, const std::vector<BPlusTreeBenchmarkResult>& results)
+{
+	fprintf(file, "%-9s %-10s %10s %10s %20s %s\n", "structure", "operation", "size", "ns/elem", "checksum", "ok");
+
+	for (const BPlusTreeBenchmarkResult& r : results)
+	{
+		fprintf(file, "%-9s %-10s %10zu %10.2f %20llu %s\n",
+			r.structure.c_str(), r.operation.c_str(), r.size, r.nsPerElement,
+			static_cast<unsigned long long>(r.checksum), r.consistent ? "ok" : "FAIL");
+	}
+}
@@ -134,7 +134,7 @@ Node* BinarySearchTree::Next(Node* node)
 
 void BinarySearchTree::Insert(int key)
 {
-	Node* newNode = new Node();
+	Node* newNode = new (mPool.allocate()) Node();
 	newNode->key = key;
 
 	if (mRoot == nullptr)
@@ -168,6 +168,31 @@ void BinarySearchTree::Insert(int key)
 	}
 }
 
+void BinarySearchTree::BuildFromSorted(const vector<int>& keys)
+{
+	Clear();
+	mRoot = BuildFromSorted(keys, 0, static_cast<int>(keys.size()), nullptr);
+}
+
+// [begin, end)   Ű Ʈ ϴ Ʈ
+Node* BinarySearchTree::BuildFromSorted(const vector<int>& keys, int begin, int end, Node* parent)
+{
+	if (begin >= end)
+	{
+		return nullptr;
+	}
+
+	int mid = begin + (end - begin) / 2;
+
+	Node* node = new (mPool.allocate()) Node();
+	node->key = keys[mid];
+	node->parent = parent;
+	node->left = BuildFromSorted(keys, begin, mid, node);
+	node->right = BuildFromSorted(keys, mid + 1, end, node);
+
+	return node;
+}
+
 void BinarySearchTree::Delete(int key)
 {
 	Node* deleteNode = Search(mRoot, key);
@@ -198,7 +223,7 @@ void BinarySearchTree::Delete(Node* node)
 }
 
 // u Ʈ v Ʈ ü
-// ׸ delete u
+// ׸ u Ǯ ش.
 void BinarySearchTree::Replace(Node* u, Node* v)
 {
 	if (u->parent == nullptr)
@@ -219,5 +244,5 @@ void BinarySearchTree::Replace(Node* u, Node* v)
 		v->parent = u->parent;
 	}
 
-	delete u;
+	mPool.deallocate(u);
 }
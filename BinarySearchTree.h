@@ -1,5 +1,8 @@
 #pragma once
 
+#include <vector>
+#include "NodePool.h"
+
 struct Node
 {
 	Node* parent = nullptr;
@@ -32,12 +35,21 @@ public:
 
 	void Insert(int key);
 
+	//  ĵ Ű Ʈ  . O(N)
+	// ĵ Ű Insert  θ ڶ O(N^2) ǹǷ,  Ű Ʈ   ְ .
+	void BuildFromSorted(const std::vector<int>& keys);
+	Node* BuildFromSorted(const std::vector<int>& keys, int begin, int end, Node* parent);
+
 	void Delete(int key);
 	void Delete(Node* node);
 
+	// 带 ϳ  ʰ Ǯ° ش. O( )
+	void Clear() { mPool.release(); mRoot = nullptr; }
+
 	void Replace(Node* u, Node* v);
 
 private:
 	Node* mRoot = nullptr;
+	NodePool<Node> mPool; //  Ǯ  ߶ .
 };
 
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+template<typename W>
+struct WeightedEdge
+{
+	int from;
+	int to;
+	W weight;
+};
+
+//    (Compressed Sparse Row) ׷
+//  0 ~ size()-1   id.
+//  v  mTargets[mOffsets[v] ~ mOffsets[v + 1])   ȴ.
+// ġ  mWeights   ġ ȴ. (  )
+//   ã  id ٷ ϹǷ ˰ O(V+E) Ѵ.
+template<typename W = int>
+class CSRGraph
+{
+public:
+	using size_type = size_t;
+	using offset_type = uint64_t;
+	using vertex_type = int;
+	using weight_type = W;
+
+	// constructor
+
+	CSRGraph() = default;
+
+	//  κ   ȸ  (  -> ڸ ġ)
+	CSRGraph(size_type vertexCount, const std::vector<std::pair<vertex_type, vertex_type>>& edges)
+		: mOffsets(vertexCount + 1, 0)
+		, mTargets(edges.size())
+	{
+		for (const auto& edge : edges)
+		{
+			mOffsets[edge.first + 1]++;
+		}
+
+		for (size_type v = 0; v < vertexCount; v++)
+		{
+			mOffsets[v + 1] += mOffsets[v];
+		}
+
+		std::vector<offset_type> cursor(mOffsets.begin(), mOffsets.end() - 1);
+		for (const auto& edge : edges)
+		{
+			mTargets[cursor[edge.first]++] = edge.second;
+		}
+	}
+
+	CSRGraph(size_type vertexCount, const std::vector<WeightedEdge<W>>& edges)
+		: mOffsets(vertexCount + 1, 0)
+		, mTargets(edges.size())
+		, mWeights(edges.size())
+	{
+		for (const auto& edge : edges)
+		{
+			mOffsets[edge.from + 1]++;
+		}
+
+		for (size_type v = 0; v < vertexCount; v++)
+		{
+			mOffsets[v + 1] += mOffsets[v];
+		}
+
+		std::vector<offset_type> cursor(mOffsets.begin(), mOffsets.end() - 1);
+		for (const auto& edge : edges)
+		{
+			offset_type pos = cursor[edge.from]++;
+			mTargets[pos] = edge.to;
+			mWeights[pos] = edge.weight;
+		}
+	}
+
+	CSRGraph(std::vector<offset_type>&& offsets, std::vector<vertex_type>&& targets, std::vector<W>&& weights = {})
+		: mOffsets(std::move(offsets))
+		, mTargets(std::move(targets))
+		, mWeights(std::move(weights))
+	{}
+
+	//
+
+	// Capacity
+
+	inline bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+	//  
+	inline size_type size() const noexcept
+	{
+		return mOffsets.empty() ? 0 : mOffsets.size() - 1;
+	}
+
+	inline size_type edge_count() const noexcept
+	{
+		return mTargets.size();
+	}
+
+	inline size_type degree(vertex_type v) const
+	{
+		return static_cast<size_type>(mOffsets[v + 1] - mOffsets[v]);
+	}
+
+	inline bool weighted() const noexcept
+	{
+		return mWeights.empty() == false;
+	}
+
+	//
+
+	// Edges
+
+	inline const vertex_type* begin(vertex_type v) const
+	{
+		return mTargets.data() + mOffsets[v];
+	}
+
+	inline const vertex_type* end(vertex_type v) const
+	{
+		return mTargets.data() + mOffsets[v + 1];
+	}
+
+	// begin(v)   ġ ġ. weighted()   .
+	inline const W* weight_begin(vertex_type v) const
+	{
+		return mWeights.data() + mOffsets[v];
+	}
+
+	inline const std::vector<offset_type>& offsets() const noexcept
+	{
+		return mOffsets;
+	}
+
+	inline const std::vector<vertex_type>& targets() const noexcept
+	{
+		return mTargets;
+	}
+
+	inline const std::vector<W>& weights() const noexcept
+	{
+		return mWeights;
+	}
+
+	//     ׷
+	CSRGraph transpose() const
+	{
+		std::vector<offset_type> offsets(mOffsets.size(), 0);
+		std::vector<vertex_type> targets(mTargets.size());
+		std::vector<W> weights(mWeights.size());
+
+		for (vertex_type to : mTargets)
+		{
+			offsets[to + 1]++;
+		}
+
+		for (size_type v = 0; v < size(); v++)
+		{
+			offsets[v + 1] += offsets[v];
+		}
+
+		std::vector<offset_type> cursor(offsets.begin(), offsets.end() - 1);
+		for (size_type v = 0; v < size(); v++)
+		{
+			for (offset_type e = mOffsets[v]; e < mOffsets[v + 1]; e++)
+			{
+				offset_type pos = cursor[mTargets[e]]++;
+				targets[pos] = static_cast<vertex_type>(v);
+
+				if (mWeights.empty() == false)
+				{
+					weights[pos] = mWeights[e];
+				}
+			}
+		}
+
+		return CSRGraph(std::move(offsets), std::move(targets), std::move(weights));
+	}
+
+	//
+
+	inline void swap(CSRGraph& other) noexcept
+	{
+		mOffsets.swap(other.mOffsets);
+		mTargets.swap(other.mTargets);
+		mWeights.swap(other.mWeights);
+	}
+
+private:
+	std::vector<offset_type> mOffsets;
+	std::vector<vertex_type> mTargets;
+	std::vector<W> mWeights;
+};
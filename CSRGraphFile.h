@@ -0,0 +1,500 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include "CSRGraph.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// CSR ׷ ̳ʸ   ( 1)
+//
+// [ 64Ʈ]
+// [offsets : uint64 x (  + 1)]  <- offsetsPos
+// [targets : int32  x  ]        <- targetsPos
+// [weights : W      x  ]        <- weightsPos (ġ  0)
+//
+//  迭 8Ʈ 迡 ϹǷ  ޸𸮿  ּҸ
+// ״ 迭   ִ. (糪 Ľ  ٷ б)
+//
+//   ⺻δ  迭 ġ, offsets ó  O(1) ˻Ѵ.   ó     .
+// offsets پų target [0,  )  begin(v), end(v)  迭   Ƿ
+//     verify = true  offsets  ʴ, target   O(V + E)  ˻Ѵ.
+
+struct CSRFileHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t byteOrder;     // 0x01020304.  ӽŰ  ٸ   δ.
+	uint64_t vertexCount;
+	uint64_t edgeCount;
+	uint32_t weightSize;    // sizeof(W). ġ  0
+	uint32_t reserved;
+	uint64_t offsetsPos;
+	uint64_t targetsPos;
+	uint64_t weightsPos;
+};
+
+static_assert(sizeof(CSRFileHeader) == 64, "CSRFileHeader must be 64 bytes");
+
+constexpr char CSRFileMagic[8] = { 'C', 'S', 'R', 'G', 'R', 'A', 'P', 'H' };
+constexpr uint32_t CSRFileVersion = 1;
+constexpr uint32_t CSRFileByteOrder = 0x01020304;
+
+inline uint64_t AlignCSRFilePos(uint64_t pos)
+{
+	return (pos + 7) & ~static_cast<uint64_t>(7);
+}
+
+// CSRGraph Ϸ Ѵ. ϸ false.
+// AdjListGraph, AdjMatrixGraph to_csr() ȯ Ѵ.
+template<typename W>
+bool WriteCSRGraph(const CSRGraph<W>& g, const std::string& path)
+{
+	static_assert(sizeof(typename CSRGraph<W>::vertex_type) == sizeof(int32_t), "vertex id must be 32-bit");
+	static_assert(alignof(W) <= 8, "weight alignment must not exceed 8");
+
+	CSRFileHeader header = {};
+	memcpy(header.magic, CSRFileMagic, sizeof(header.magic));
+	header.version = CSRFileVersion;
+	header.byteOrder = CSRFileByteOrder;
+	header.vertexCount = g.size();
+	header.edgeCount = g.edge_count();
+	header.weightSize = g.weighted() ? static_cast<uint32_t>(sizeof(W)) : 0;
+	header.offsetsPos = sizeof(CSRFileHeader);
+	header.targetsPos = AlignCSRFilePos(header.offsetsPos + (header.vertexCount + 1) * sizeof(uint64_t));
+	header.weightsPos = g.weighted() ? AlignCSRFilePos(header.targetsPos + header.edgeCount * sizeof(int32_t)) : 0;
+
+	FILE* file = fopen(path.c_str(), "wb");
+	if (file == nullptr)
+	{
+		return false;
+	}
+
+	const char padding[8] = {};
+	uint64_t pos = 0;
+	bool ok = true;
+
+	// 迭 ϳ ° . target ġ 0 ä.
+	auto write = [&](uint64_t target, const void* data, size_t bytes)
+		{
+			if (ok && pos < target)
+			{
+				ok = fwrite(padding, 1, static_cast<size_t>(target - pos), file) == target - pos;
+				pos = target;
+			}
+
+			if (ok && bytes > 0)
+			{
+				ok = fwrite(data, 1, bytes, file) == bytes;
+				pos += bytes;
+			}
+		};
+
+	//   offsets [0] ϳ .
+	const uint64_t emptyOffset = 0;
+
+	write(0, &header, sizeof(header));
+
+	if (g.offsets().empty())
+	{
+		write(header.offsetsPos, &emptyOffset, sizeof(emptyOffset));
+	}
+	else
+	{
+		write(header.offsetsPos, g.offsets().data(), g.offsets().size() * sizeof(uint64_t));
+	}
+
+	write(header.targetsPos, g.targets().data(), g.targets().size() * sizeof(int32_t));
+
+	if (g.weighted())
+	{
+		write(header.weightsPos, g.weights().data(), g.weights().size() * sizeof(W));
+	}
+
+	ok = (fclose(file) == 0) && ok;
+	return ok;
+}
+
+// ޸𸮿  CSR ׷ 
+//    ʰ ε ޸𸮸 ״ offsets/targets/weights 迭 Ѵ.
+//     ü оǷ    ð  ũ ϴ.
+// ̽ CSRGraph Ƽ ׷ ˰ ״ ѱ  ִ.
+template<typename W = int>
+class MappedCSRGraph
+{
+public:
+	using size_type = size_t;
+	using offset_type = uint64_t;
+	using vertex_type = int;
+	using weight_type = W;
+
+	// constructor
+
+	MappedCSRGraph() = default;
+
+	explicit MappedCSRGraph(const std::string& path, bool verify = false)
+	{
+		open(path, verify);
+	}
+
+	MappedCSRGraph(const MappedCSRGraph& other) = delete;
+
+	MappedCSRGraph(MappedCSRGraph&& other) noexcept
+	{
+		swap(other);
+	}
+
+	//
+
+	// destructor
+
+	~MappedCSRGraph()
+	{
+		close();
+	}
+
+	//
+
+	// operator =
+
+	MappedCSRGraph& operator=(const MappedCSRGraph& other) = delete;
+
+	MappedCSRGraph& operator=(MappedCSRGraph&& other) noexcept
+	{
+		MappedCSRGraph temp(std::move(other));
+		swap(temp);
+		return *this;
+	}
+
+	//
+
+	//  ϰ  ˻Ѵ.    false.
+	// verify true offsets targets ü ˻Ѵ. ( ü   д´)
+	bool open(const std::string& path, bool verify = false)
+	{
+		close();
+
+		if (map(path) == false)
+		{
+			return false;
+		}
+
+		if (validate() == false || (verify && validateArrays() == false))
+		{
+			close();
+			return false;
+		}
+
+		const char* base = static_cast<const char*>(mData);
+		const CSRFileHeader* header = reinterpret_cast<const CSRFileHeader*>(base);
+
+		mVertexCount = static_cast<size_type>(header->vertexCount);
+		mEdgeCount = static_cast<size_type>(header->edgeCount);
+		mOffsets = reinterpret_cast<const offset_type*>(base + header->offsetsPos);
+		mTargets = reinterpret_cast<const vertex_type*>(base + header->targetsPos);
+		mWeights = header->weightSize != 0 ? reinterpret_cast<const W*>(base + header->weightsPos) : nullptr;
+
+		return true;
+	}
+
+	void close()
+	{
+		unmap();
+
+		mVertexCount = 0;
+		mEdgeCount = 0;
+		mOffsets = nullptr;
+		mTargets = nullptr;
+		mWeights = nullptr;
+	}
+
+	inline bool is_open() const noexcept
+	{
+		return mData != nullptr;
+	}
+
+	// Capacity
+
+	inline bool empty() const noexcept
+	{
+		return mVertexCount == 0;
+	}
+
+	inline size_type size() const noexcept
+	{
+		return mVertexCount;
+	}
+
+	inline size_type edge_count() const noexcept
+	{
+		return mEdgeCount;
+	}
+
+	inline size_type degree(vertex_type v) const
+	{
+		return static_cast<size_type>(mOffsets[v + 1] - mOffsets[v]);
+	}
+
+	inline bool weighted() const noexcept
+	{
+		return mWeights != nullptr;
+	}
+
+	//
+
+	// Edges
+
+	inline const vertex_type* begin(vertex_type v) const
+	{
+		return mTargets + mOffsets[v];
+	}
+
+	inline const vertex_type* end(vertex_type v) const
+	{
+		return mTargets + mOffsets[v + 1];
+	}
+
+	inline const W* weight_begin(vertex_type v) const
+	{
+		return mWeights + mOffsets[v];
+	}
+
+	inline const offset_type* offsets() const noexcept
+	{
+		return mOffsets;
+	}
+
+	inline const vertex_type* targets() const noexcept
+	{
+		return mTargets;
+	}
+
+	inline const W* weights() const noexcept
+	{
+		return mWeights;
+	}
+
+	//
+
+	inline void swap(MappedCSRGraph& other) noexcept
+	{
+		std::swap(mData, other.mData);
+		std::swap(mFileSize, other.mFileSize);
+#ifdef _WIN32
+		std::swap(mFile, other.mFile);
+		std::swap(mMapping, other.mMapping);
+#endif
+		std::swap(mVertexCount, other.mVertexCount);
+		std::swap(mEdgeCount, other.mEdgeCount);
+		std::swap(mOffsets, other.mOffsets);
+		std::swap(mTargets, other.mTargets);
+		std::swap(mWeights, other.mWeights);
+	}
+
+private:
+	bool validate() const
+	{
+		if (mFileSize < sizeof(CSRFileHeader))
+		{
+			return false;
+		}
+
+		const CSRFileHeader* header = static_cast<const CSRFileHeader*>(mData);
+
+		if (memcmp(header->magic, CSRFileMagic, sizeof(CSRFileMagic)) != 0
+			|| header->version != CSRFileVersion
+			|| header->byteOrder != CSRFileByteOrder)
+		{
+			return false;
+		}
+
+		if (header->weightSize != 0 && header->weightSize != sizeof(W))
+		{
+			return false;
+		}
+
+		// offsets 迭 (  + 1) * 8 Ʈ̹Ƿ    ũ⺸ ۾ƾ Ѵ.
+		if (header->vertexCount >= mFileSize)
+		{
+			return false;
+		}
+
+		// 迭  ȿ ִ, 8Ʈ 迡 ϴ Ȯ.
+		auto fits = [this](uint64_t pos, uint64_t count, uint64_t elementSize)
+			{
+				return pos % 8 == 0
+					&& pos <= mFileSize
+					&& count <= (mFileSize - pos) / elementSize;
+			};
+
+		if (fits(header->offsetsPos, header->vertexCount + 1, sizeof(offset_type)) == false
+			|| fits(header->targetsPos, header->edgeCount, sizeof(vertex_type)) == false)
+		{
+			return false;
+		}
+
+		if (header->weightSize != 0 && fits(header->weightsPos, header->edgeCount, sizeof(W)) == false)
+		{
+			return false;
+		}
+
+		const offset_type* offsets = reinterpret_cast<const offset_type*>(static_cast<const char*>(mData) + header->offsetsPos);
+		return offsets[0] == 0 && offsets[header->vertexCount] == header->edgeCount;
+	}
+
+	// validate()  Ͽ offsets  ʴ,  target [0,  )  ȮѴ.
+	bool validateArrays() const
+	{
+		const char* base = static_cast<const char*>(mData);
+		const CSRFileHeader* header = reinterpret_cast<const CSRFileHeader*>(base);
+		const offset_type* offsets = reinterpret_cast<const offset_type*>(base + header->offsetsPos);
+		const int32_t* targets = reinterpret_cast<const int32_t*>(base + header->targetsPos);
+
+		for (uint64_t v = 0; v < header->vertexCount; v++)
+		{
+			if (offsets[v] > offsets[v + 1])
+			{
+				return false;
+			}
+		}
+
+		for (uint64_t e = 0; e < header->edgeCount; e++)
+		{
+			if (targets[e] < 0 || static_cast<uint64_t>(targets[e]) >= header->vertexCount)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+#ifdef _WIN32
+	bool map(const std::string& path)
+	{
+		mFile = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (mFile == INVALID_HANDLE_VALUE)
+		{
+			return false;
+		}
+
+		LARGE_INTEGER size;
+		if (::GetFileSizeEx(mFile, &size) == FALSE || size.QuadPart == 0)
+		{
+			unmap();
+			return false;
+		}
+
+		mFileSize = static_cast<size_t>(size.QuadPart);
+
+		mMapping = ::CreateFileMappingA(mFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mMapping == nullptr)
+		{
+			unmap();
+			return false;
+		}
+
+		mData = ::MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0);
+		if (mData == nullptr)
+		{
+			unmap();
+			return false;
+		}
+
+		return true;
+	}
+
+	void unmap()
+	{
+		if (mData)
+		{
+			::UnmapViewOfFile(mData);
+		}
+
+		if (mMapping)
+		{
+			::CloseHandle(mMapping);
+		}
+
+		if (mFile != INVALID_HANDLE_VALUE)
+		{
+			::CloseHandle(mFile);
+		}
+
+		mData = nullptr;
+		mMapping = nullptr;
+		mFile = INVALID_HANDLE_VALUE;
+		mFileSize = 0;
+	}
+#else
+	bool map(const std::string& path)
+	{
+		int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd == -1)
+		{
+			return false;
+		}
+
+		struct stat st;
+		if (::fstat(fd, &st) != 0 || st.st_size == 0)
+		{
+			::close(fd);
+			return false;
+		}
+
+		mFileSize = static_cast<size_t>(st.st_size);
+
+		void* data = ::mmap(nullptr, mFileSize, PROT_READ, MAP_SHARED, fd, 0);
+
+		//    ũʹ ʿ .
+		::close(fd);
+
+		if (data == MAP_FAILED)
+		{
+			mFileSize = 0;
+			return false;
+		}
+
+		mData = data;
+		return true;
+	}
+
+	void unmap()
+	{
+		if (mData)
+		{
+			::munmap(mData, mFileSize);
+		}
+
+		mData = nullptr;
+		mFileSize = 0;
+	}
+#endif
+
+private:
+	void* mData = nullptr;
+	size_t mFileSize = 0;
+#ifdef _WIN32
+	HANDLE mFile = INVALID_HANDLE_VALUE;
+	HANDLE mMapping = nullptr;
+#endif
+
+	size_type mVertexCount = 0;
+	size_type mEdgeCount = 0;
+	const offset_type* mOffsets = nullptr;
+	const vertex_type* mTargets = nullptr;
+	const W* mWeights = nullptr;
+};
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ConcurrentSkipList.h"
+#include "Parallel.h"
+#include "RedBlackTree.h"
+
+//    ġũ
+//  尡  ʿ ã, ֱ, ⸦   ʴ ó   .
+// ConcurrentSkipList std::mutex ϳ  RedBlackTree  , б  Ѵ.
+//
+//	ConcurrentMapBenchmarkConfig config;
+//	config.threadCounts = { 1, 4, 8 };
+//	PrintConcurrentMapBenchmark(stdout, RunConcurrentMapBenchmark(config));
+//
+// Ű [0, keyRange)  . бⰡ ƴ  ֱ Ⱑ ݾ̶ ũⰡ initialSize ó ӹ.
+//       ֱ,   ´ ȮѴ.
+
+struct ConcurrentMapBenchmarkConfig
+{
+	std::vector<unsigned> threadCounts = { 1, 2, 4, 8 };
+	std::vector<unsigned> readPercents = { 100, 90, 50 };
+	uint32_t keyRange = 1 << 20;
+	size_t initialSize = 1 << 19;         //   ־  Ű  (keyRange ۾ƾ Ѵ)
+	size_t operationsPerThread = 1 << 20;
+	uint64_t seed = 1;
+};
+
+struct ConcurrentMapBenchmarkResult
+{
+	std::string structure;
+	unsigned threads = 0;
+	unsigned readPercent = 0;
+	double millionOpsPerSecond = 0;
+	size_t finalSize = 0;
+	bool consistent = false; //   = ó  +  ֱ -  
+};
+
+// std::mutex ϳ  RedBlackTree.   ϳ ʷ ȴ.
+class LockedRedBlackTree
+{
+public:
+	bool insert(uint32_t key, uint32_t value)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mTree.try_emplace(key, value).second;
+	}
+
+	bool erase(uint32_t key)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mTree.erase(key) != 0;
+	}
+
+	bool find(uint32_t key, uint32_t& value) const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		auto it = mTree.find(key);
+		if (it == mTree.end())
+		{
+			return false;
+		}
+
+		value = it->second;
+		return true;
+	}
+
+	size_t size() const
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mTree.size();
+	}
+
+private:
+	mutable std::mutex mMutex;
+	RedBlackTree<uint32_t, uint32_t> mTree;
+};
+
+//  尡 غ  Բ ߽Ű ɸ ð .
+template<typename Map>
+ConcurrentMapBenchmarkResult MeasureConcurrentMap(const char* name, const ConcurrentMapBenchmarkConfig& config,
+	unsigned threadCount, unsigned readPercent)
+{
+	Map map;
+
+	std::mt19937_64 initRandom(config.seed);
+	size_t initial = 0;
+
+	while (initial < config.initialSize)
+	{
+		const uint32_t key = static_cast<uint32_t>(initRandom() % config.keyRange);
+		initial += map.insert(key, key) ? 1 : 0;
+	}
+
+	std::atomic<unsigned> ready = 0;
+	std::atomic<bool> start = false;
+	std::atomic<int64_t> sizeChange = 0;
+	std::atomic<uint32_t> checksum = 0; // ã   бⰡ  ʰ Ѵ.
+
+	auto worker = [&](unsigned index)
+	{
+		std::mt19937_64 random(config.seed * 7919 + index + 1);
+		int64_t change = 0;
+		uint32_t sink = 0;
+
+		ready.fetch_add(1, std::memory_order_acq_rel);
+		while (start.load(std::memory_order_acquire) == false)
+		{
+			std::this_thread::yield();
+		}
+
+		for (size_t i = 0; i < config.operationsPerThread; i++)
+		{
+			const uint64_t bits = random();
+			const uint32_t key = static_cast<uint32_t>(bits % config.keyRange);
+			const unsigned dice = static_cast<unsigned>((bits >> 32) % 200);
+
+			if (dice < readPercent * 2)
+			{
+				uint32_t value = 0;
+				sink += map.find(key, value) ? value : 0;
+			}
+			else if (dice % 2 == 0)
+			{
+				change += map.insert(key, key) ? 1 : 0;
+			}
+			else
+			{
+				change -= map.erase(key) ? 1 : 0;
+			}
+		}
+
+		sizeChange.fetch_add(change, std::memory_order_relaxed);
+		checksum.fetch_add(sink, std::memory_order_relaxed);
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount);
+
+	for (unsigned t = 0; t < threadCount; t++)
+	{
+		threads.emplace_back(worker, t);
+	}
+
+	while (ready.load(std::memory_order_acquire) < threadCount)
+	{
+		std::this_thread::yield();
+	}
+
+	const auto begin = std::chrono::steady_clock::now();
+	start.store(true, std::memory_order_release);
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+	ConcurrentMapBenchmarkResult result;
+	result.structure = name;
+	result.threads = threadCount;
+	result.readPercent = readPercent;
+	result.millionOpsPerSecond = static_cast<double>(config.operationsPerThread) * threadCount / seconds / 1e6;
+	result.finalSize = map.size();
+	result.consistent = static_cast<int64_t>(result.finalSize) == static_cast<int64_t>(initial) + sizeChange.load();
+
+	return result;
+}
+
+inline std::vector<ConcurrentMapBenchmarkResult> RunConcurrentMapBenchmark(const ConcurrentMapBenchmarkConfig& config = ConcurrentMapBenchmarkConfig())
+{
+	std::vector<ConcurrentMapBenchmarkResult> results;
+
+	for (unsigned readPercent : config.readPercents)
+	{
+		for (unsigned threads : config.threadCounts)
+		{
+			threads = (threads == 0) ? HardwareThreadCount() : threads;
+
+			results.push_back(MeasureConcurrentMap<ConcurrentSkipList<uint32_t, uint32_t>>("skip list", config, threads, readPercent));
+			results.push_back(MeasureConcurrentMap<LockedRedBlackTree>("mutex rb tree", config, threads, readPercent));
+		}
+	}
+
+	return results;
+}
+
+//   ǥ
+inline void PrintConcurrentMapBenchmark(FILE* file, const std::vector<ConcurrentMapBenchmarkResult>& results)
+{
+	fprintf(file, "%-14s %8s %6s %10s %10s %s\n", "structure", "threads", "read%", "Mops/s", "size", "ok");
+
+	for (const ConcurrentMapBenchmarkResult& r : results)
+	{
+		fprintf(file, "%-14s %8u %6u %10.2f %10zu %s\n",
+			r.structure.c_str(), r.threads, r.readPercent, r.millionOpsPerSecond, r.finalSize,
+			r.consistent ? "ok" : "FAIL");
+	}
+}
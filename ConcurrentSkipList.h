@@ -0,0 +1,509 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <utility>
+#include "EpochReclaimer.h"
+
+//   (lock-free) ŵ Ʈ
+//  尡   ÿ ã ְ  ĵ . (Herlihy, Shavit. The Art of Multiprocessor Programming 14)
+// -  ̸ŭ  ũ .  h Ȯ (1/4)^(h-1)̶  ܰϼ ǳʶٴ  д.
+// -     ũ   Ʈ ǥ (mark) Ѵ. ǥõ ũ CAS ϹǷ
+//     ڿ  尡  ʴ´.  Ʒ ܰ迡 ǥ 尡  ̴.
+// - ǥõ  Žϴ 尡  .
+// -   EpochReclaimer Ѱ ٸ 尡    ڿ .
+//
+// RedBlackTree ޸ ݺڿ   ʴ´. ٸ 尡  带   ֱ ̴.
+// find   ְ,  ȸ for_each_range Լ ѱ.    ٲ ʴ´.
+//  ȸ size ٸ 尡 ٲٴ ̸   Ȯ ° ƴ  ִ.
+// Ҹڿ clear ٸ 尡    θ.
+template<typename Key, typename Value, typename Compare = std::less<Key>>
+class ConcurrentSkipList
+{
+private:
+	static constexpr uint32_t MaxHeight = 16; // 4^16 O(logN)
+
+	using Link = std::atomic<uintptr_t>; //   ּ | ǥ
+
+	static constexpr uintptr_t MarkBit = 1;
+
+	// ũ 迭  ٷ ڿ ̸ŭ δ.
+	struct alignas(alignof(Link)) Node
+	{
+		template<typename K, typename V>
+		Node(uint32_t nodeHeight, K&& nodeKey, V&& nodeValue)
+			: key(std::forward<K>(nodeKey))
+			, value(std::forward<V>(nodeValue))
+			, height(nodeHeight)
+		{}
+
+		Key key;
+		Value value;
+		// ִ   尡 ϳ .   ũ ۾  0 Ǹ ȸѴ.
+		std::atomic<int> owners = 2;
+		uint32_t height;
+	};
+
+public:
+	// constructor
+
+	explicit ConcurrentSkipList(const Compare& comp = Compare())
+		: mCompare(comp)
+	{
+		mHead = static_cast<Node*>(::operator new(NodeBytes(MaxHeight)));
+
+		for (uint32_t level = 0; level < MaxHeight; level++)
+		{
+			::new (static_cast<void*>(&Links(mHead)[level])) Link(0);
+		}
+	}
+
+	ConcurrentSkipList(const ConcurrentSkipList&) = delete;
+	ConcurrentSkipList& operator=(const ConcurrentSkipList&) = delete;
+
+	//
+
+	// destructor
+
+	~ConcurrentSkipList()
+	{
+		clear();
+		::operator delete(mHead);
+	}
+
+	//
+
+	// Capacity
+
+	inline bool empty() const
+	{
+		return size() == 0;
+	}
+
+	inline size_t size() const
+	{
+		return mSize.load(std::memory_order_relaxed);
+	}
+
+	//
+
+	// Modifiers
+
+	// ̹ ִ Ű  ʰ false
+	template<typename K, typename V>
+	bool insert(K&& key, V&& value)
+	{
+		EpochGuard guard;
+
+		Node* preds[MaxHeight];
+		Node* succs[MaxHeight];
+		Node* node = nullptr;
+
+		while (true)
+		{
+			// 带  ڿ key Ű  Ƿ  Ű ã´.
+			const bool found = (node == nullptr) ? Find(key, preds, succs) : Find(node->key, preds, succs);
+
+			if (found)
+			{
+				if (node != nullptr)
+				{
+					DestroyNode(node);
+				}
+
+				return false;
+			}
+
+			if (node == nullptr)
+			{
+				node = CreateNode(RandomHeight(), std::forward<K>(key), std::forward<V>(value));
+			}
+
+			for (uint32_t level = 0; level < node->height; level++)
+			{
+				Links(node)[level].store(reinterpret_cast<uintptr_t>(succs[level]), std::memory_order_relaxed);
+			}
+
+			//  Ʒ ܰ迡 ̸  ̴.
+			uintptr_t expected = reinterpret_cast<uintptr_t>(succs[0]);
+			if (Links(preds[0])[0].compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(node),
+				std::memory_order_release, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+
+		mSize.fetch_add(1, std::memory_order_relaxed);
+		RaiseHeight(node->height);
+
+		LinkUpperLevels(node, preds, succs);
+
+		//  ܰ踦 ̴ ̿   ũ  .
+		if (Marked(Links(node)[0].load(std::memory_order_acquire)))
+		{
+			Find(node->key, preds, succs);
+		}
+
+		Release(node);
+		return true;
+	}
+
+	//  Ű false
+	bool erase(const Key& key)
+	{
+		EpochGuard guard;
+
+		Node* preds[MaxHeight];
+		Node* succs[MaxHeight];
+
+		if (Find(key, preds, succs) == false)
+		{
+			return false;
+		}
+
+		Node* node = succs[0];
+
+		//  ܰ ǥѴ.    ܰ赵 ǥ ִ 尡   ʰ Ѵ.
+		for (uint32_t level = node->height - 1; level > 0; level--)
+		{
+			uintptr_t next = Links(node)[level].load(std::memory_order_relaxed);
+			while (Marked(next) == false &&
+				Links(node)[level].compare_exchange_weak(next, next | MarkBit, std::memory_order_acq_rel) == false)
+			{
+			}
+		}
+
+		//  Ʒ ܰ迡 ǥ  ϳ  ̴.
+		uintptr_t next = Links(node)[0].load(std::memory_order_relaxed);
+		while (true)
+		{
+			if (Marked(next))
+			{
+				return false;
+			}
+
+			if (Links(node)[0].compare_exchange_weak(next, next | MarkBit, std::memory_order_acq_rel))
+			{
+				break;
+			}
+		}
+
+		mSize.fetch_sub(1, std::memory_order_relaxed);
+
+		//   ܰ迡 .
+		Find(key, preds, succs);
+		Release(node);
+		return true;
+	}
+
+	// ٸ 尡    θ. ȸ ٸ  EpochReclaimer .
+	void clear()
+	{
+		uintptr_t link = Links(mHead)[0].load(std::memory_order_acquire);
+
+		while (Ptr(link) != nullptr)
+		{
+			Node* node = Ptr(link);
+			link = Links(node)[0].load(std::memory_order_relaxed);
+			DestroyNode(node);
+		}
+
+		for (uint32_t level = 0; level < MaxHeight; level++)
+		{
+			Links(mHead)[level].store(0, std::memory_order_relaxed);
+		}
+
+		mHeight.store(1, std::memory_order_relaxed);
+		mSize.store(0, std::memory_order_relaxed);
+	}
+
+	//
+
+	// Lookup
+
+	// ã value Ѵ.
+	bool find(const Key& key, Value& value) const
+	{
+		EpochGuard guard;
+
+		Node* node = LowerBound(key);
+		if (node == nullptr || mCompare(key, node->key))
+		{
+			return false;
+		}
+
+		value = node->value;
+		return true;
+	}
+
+	bool contains(const Key& key) const
+	{
+		EpochGuard guard;
+
+		Node* node = LowerBound(key);
+		return node != nullptr && mCompare(key, node->key) == false;
+	}
+
+	// [lo, hi)  Ҹ func(key, value) θ   ش.
+	//  Ʒ ܰ踦 󰡸 ǥõ ()  ǳʶڴ.
+	template<typename Func>
+	size_t for_each_range(const Key& lo, const Key& hi, Func func) const
+	{
+		EpochGuard guard;
+
+		size_t count = 0;
+
+		for (Node* node = LowerBound(lo); node != nullptr && mCompare(node->key, hi);)
+		{
+			const uintptr_t next = Links(node)[0].load(std::memory_order_acquire);
+
+			if (Marked(next) == false)
+			{
+				func(static_cast<const Key&>(node->key), static_cast<const Value&>(node->value));
+				count++;
+			}
+
+			node = Ptr(next);
+		}
+
+		return count;
+	}
+
+	// [lo, hi)   . O( ũ)
+	size_t count_range(const Key& lo, const Key& hi) const
+	{
+		return for_each_range(lo, hi, [](const Key&, const Value&) {});
+	}
+
+	//
+
+private:
+	static inline Node* Ptr(uintptr_t link)
+	{
+		return reinterpret_cast<Node*>(link & ~MarkBit);
+	}
+
+	static inline bool Marked(uintptr_t link)
+	{
+		return (link & MarkBit) != 0;
+	}
+
+	static constexpr size_t NodeBytes(uint32_t height)
+	{
+		return sizeof(Node) + sizeof(Link) * height;
+	}
+
+	static inline Link* Links(Node* node)
+	{
+		return reinterpret_cast<Link*>(reinterpret_cast<char*>(node) + sizeof(Node));
+	}
+
+	template<typename K, typename V>
+	static Node* CreateNode(uint32_t height, K&& key, V&& value)
+	{
+		void* memory = ::operator new(NodeBytes(height));
+		Node* node = nullptr;
+
+		try
+		{
+			node = ::new (memory) Node(height, std::forward<K>(key), std::forward<V>(value));
+		}
+		catch (...)
+		{
+			::operator delete(memory);
+			throw;
+		}
+
+		for (uint32_t level = 0; level < height; level++)
+		{
+			::new (static_cast<void*>(&Links(node)[level])) Link(0);
+		}
+
+		return node;
+	}
+
+	static void DestroyNode(void* memory)
+	{
+		Node* node = static_cast<Node*>(memory);
+		node->~Node();
+		::operator delete(memory);
+	}
+
+	// ִ   尡  ũ ۾ ġ θ.    ȸ ñ.
+	static void Release(Node* node)
+	{
+		if (node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			EpochReclaimer::instance().retire(node, &DestroyNode);
+		}
+	}
+
+	// 1/4 Ȯ  ܰ辿 .
+	static uint32_t RandomHeight()
+	{
+		static thread_local uint64_t state = 0;
+
+		if (state == 0)
+		{
+			state = reinterpret_cast<uintptr_t>(&state) ^ 0x9E3779B97F4A7C15ull;
+		}
+
+		// xorshift64
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		uint64_t bits = state;
+		uint32_t height = 1;
+
+		while (height < MaxHeight && (bits & 3) == 0)
+		{
+			height++;
+			bits >>= 2;
+		}
+
+		return height;
+	}
+
+	void RaiseHeight(uint32_t height)
+	{
+		uint32_t current = mHeight.load(std::memory_order_relaxed);
+
+		while (current < height &&
+			mHeight.compare_exchange_weak(current, height, std::memory_order_relaxed) == false)
+		{
+		}
+	}
+
+	// ܰ踶 key    (preds)    (succs) Ѵ.
+	//   ǥõ  .   尡 ٲ ó ٽ ã´.
+	//  Ʒ ܰ  尡 key  true
+	bool Find(const Key& key, Node** preds, Node** succs) const
+	{
+	retry:
+		Node* pred = mHead;
+
+		for (uint32_t level = MaxHeight; level-- > 0;)
+		{
+			Node* curr = Ptr(Links(pred)[level].load(std::memory_order_acquire));
+
+			while (curr != nullptr)
+			{
+				uintptr_t next = Links(curr)[level].load(std::memory_order_acquire);
+
+				while (Marked(next))
+				{
+					uintptr_t expected = reinterpret_cast<uintptr_t>(curr);
+					if (Links(pred)[level].compare_exchange_strong(expected, next & ~MarkBit,
+						std::memory_order_acq_rel, std::memory_order_acquire) == false)
+					{
+						goto retry;
+					}
+
+					curr = Ptr(next);
+					if (curr == nullptr)
+					{
+						break;
+					}
+
+					next = Links(curr)[level].load(std::memory_order_acquire);
+				}
+
+				if (curr == nullptr || mCompare(curr->key, key) == false)
+				{
+					break;
+				}
+
+				pred = curr;
+				curr = Ptr(next);
+			}
+
+			preds[level] = pred;
+			succs[level] = curr;
+		}
+
+		return succs[0] != nullptr && mCompare(key, succs[0]->key) == false;
+	}
+
+	// key ̻ ù . ǥõ   ʰ ǳʶڴ.
+	Node* LowerBound(const Key& key) const
+	{
+		Node* pred = mHead;
+		Node* curr = nullptr;
+
+		for (uint32_t level = mHeight.load(std::memory_order_relaxed); level-- > 0;)
+		{
+			curr = Ptr(Links(pred)[level].load(std::memory_order_acquire));
+
+			while (curr != nullptr)
+			{
+				const uintptr_t next = Links(curr)[level].load(std::memory_order_acquire);
+
+				if (Marked(next))
+				{
+					curr = Ptr(next);
+					continue;
+				}
+
+				if (mCompare(curr->key, key) == false)
+				{
+					break;
+				}
+
+				pred = curr;
+				curr = Ptr(next);
+			}
+		}
+
+		return curr;
+	}
+
+	//  Ʒ ܰ迡  带  ܰ迡 δ.
+	//   尡  ϸ (ũ ǥõǸ) ׸д.
+	void LinkUpperLevels(Node* node, Node** preds, Node** succs)
+	{
+		for (uint32_t level = 1; level < node->height; level++)
+		{
+			while (true)
+			{
+				// node ũ ̹ ڸ   . ǥõǾ  ׸д.
+				uintptr_t next = Links(node)[level].load(std::memory_order_acquire);
+				if (Marked(next))
+				{
+					return;
+				}
+
+				const uintptr_t succ = reinterpret_cast<uintptr_t>(succs[level]);
+				if (next != succ && Links(node)[level].compare_exchange_strong(next, succ, std::memory_order_acq_rel) == false)
+				{
+					return; // ǥõǾ.
+				}
+
+				uintptr_t expected = succ;
+				if (Links(preds[level])[level].compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(node),
+					std::memory_order_release, std::memory_order_relaxed))
+				{
+					break;
+				}
+
+				// ڸ ٲ. ٽ ã´.    ׸д.
+				Find(node->key, preds, succs);
+
+				if (succs[0] != node)
+				{
+					return;
+				}
+			}
+		}
+	}
+
+private:
+	Compare mCompare;
+	Node* mHead;                               //  MaxHeight Ӹ . Ű   ʴ´.
+	std::atomic<uint32_t> mHeight = 1;         // ݱ    ū  (Ž  ܰ)
+	std::atomic<size_t> mSize = 0;
+};
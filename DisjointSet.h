@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// μ  (Union-Find)
+//   + ũ  ġ
+//  ϳ O((N)) (ǻ )
+class DisjointSet
+{
+public:
+	explicit DisjointSet(size_t count)
+		: mParent(count)
+		, mRank(count, 0)
+	{
+		for (size_t i = 0; i < count; i++)
+		{
+			mParent[i] = static_cast<int>(i);
+		}
+	}
+
+	inline size_t size() const noexcept
+	{
+		return mParent.size();
+	}
+
+	//   : ã   带 θ Ѵ.
+	//     ȸ .
+	inline int Find(int x)
+	{
+		while (mParent[x] != x)
+		{
+			mParent[x] = mParent[mParent[x]];
+			x = mParent[x];
+		}
+
+		return x;
+	}
+
+	//   ģ. ̹  ̸ false.
+	inline bool Merge(int a, int b)
+	{
+		a = Find(a);
+		b = Find(b);
+
+		if (a == b)
+		{
+			return false;
+		}
+
+		// ũ  Ʈ  Ʈ ؿ δ.
+		if (mRank[a] < mRank[b])
+		{
+			std::swap(a, b);
+		}
+
+		mParent[b] = a;
+
+		if (mRank[a] == mRank[b])
+		{
+			mRank[a]++;
+		}
+
+		return true;
+	}
+
+	inline bool Same(int a, int b)
+	{
+		return Find(a) == Find(b);
+	}
+
+private:
+	std::vector<int> mParent;
+	std::vector<unsigned char> mRank;
+};
@@ -0,0 +1,442 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+#include "CSRGraph.h"
+#include "Parallel.h"
+
+struct EdgeListLoadStats
+{
+	size_t vertices = 0;
+	size_t edges = 0;
+	size_t bytes = 0;          //  ũ (    )
+	double countSeconds = 0;   // 1)  
+	double scatterSeconds = 0; // 2) ġ
+
+	inline double seconds() const
+	{
+		return countSeconds + scatterSeconds;
+	}
+
+	inline double edges_per_second() const
+	{
+		return seconds() > 0 ? edges / seconds() : 0;
+	}
+};
+
+// ؽƮ   δ
+//  ٿ "u v w" (w ϸ 1).  ٰ '#', '%' ϴ  ǳʶڴ.
+//     ū id + 1.
+//
+//  chunkBytes  а,    迡   ŭ  from_chars  ĽѴ.
+// 1)   :        offsets .
+// 2) ġ     :  ٽ    ڱ ڸ(cursor[u]++) ٷ .
+//  ޸𸮸 Ҵ ʰ,  迭 ܿ  ũ⸸ŭ ۸ Ѵ.
+//        ٸ  ִ.
+//    Ƿ path ǰ  ִ Ϲ ̾ Ѵ. (, FIFO Ѵ)
+template<typename W = int>
+class EdgeListLoader
+{
+public:
+	explicit EdgeListLoader(size_t chunkBytes = 64 << 20, unsigned threadCount = 0)
+		: mChunkBytes(std::max<size_t>(chunkBytes, 1 << 10))
+		, mThreadCount(threadCount == 0 ? HardwareThreadCount() : threadCount)
+		, mPool(mThreadCount)
+		, mLocalFrom(mThreadCount)
+		, mLocalMax(mThreadCount)
+	{}
+
+	// ϸ ( , ߸ , ǰ⳪ б ,   д   ٲ) false, graph ٲ ʴ´.
+	bool Load(const std::string& path, CSRGraph<W>& graph)
+	{
+		mStats = EdgeListLoadStats();
+		mDegrees.reset();
+		mDegreeCapacity = 0;
+
+		FILE* file = fopen(path.c_str(), "rb");
+		if (file == nullptr)
+		{
+			return false;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+
+		size_t vertexCount = 0;
+		bool ok = countDegrees(file, vertexCount);
+		const size_t bytes = mStats.bytes;
+
+		auto middle = std::chrono::steady_clock::now();
+
+		std::vector<typename CSRGraph<W>::offset_type> offsets;
+		std::vector<typename CSRGraph<W>::vertex_type> targets;
+		std::vector<W> weights;
+
+		if (ok)
+		{
+			offsets.resize(vertexCount + 1);
+			offsets[0] = 0;
+
+			//   ϸ鼭  迭 ״ ġ cursor ٲ۴.
+			for (size_t v = 0; v < vertexCount; v++)
+			{
+				uint64_t degree = mDegrees[v].load(std::memory_order_relaxed);
+				mDegrees[v].store(offsets[v], std::memory_order_relaxed);
+				offsets[v + 1] = offsets[v] + degree;
+			}
+
+			targets.resize(offsets.back());
+			weights.resize(offsets.back());
+
+			ok = fseek(file, 0, SEEK_SET) == 0 && scatterEdges(file, offsets, targets, weights);
+		}
+
+		// ġ   cursor   ۿ ־ Ѵ.
+		// ڶ ä  ĭ 0    ´.
+		for (size_t v = 0; ok && v < vertexCount; v++)
+		{
+			ok = mDegrees[v].load(std::memory_order_relaxed) == offsets[v + 1];
+		}
+
+		fclose(file);
+		mDegrees.reset();
+		mDegreeCapacity = 0;
+
+		auto end = std::chrono::steady_clock::now();
+
+		if (ok == false)
+		{
+			return false;
+		}
+
+		mStats.vertices = vertexCount;
+		mStats.edges = targets.size();
+		mStats.bytes = bytes;
+		mStats.countSeconds = std::chrono::duration<double>(middle - start).count();
+		mStats.scatterSeconds = std::chrono::duration<double>(end - middle).count();
+
+		graph = CSRGraph<W>(std::move(offsets), std::move(targets), std::move(weights));
+		return true;
+	}
+
+	inline const EdgeListLoadStats& stats() const noexcept
+	{
+		return mStats;
+	}
+
+private:
+	static inline bool isSpace(char c)
+	{
+		return c == ' ' || c == '\t' || c == '\r';
+	}
+
+	// [first, last)    Ľ  onEdge(u, v, w) ȣѴ.
+	template<typename Func>
+	static bool parseLines(const char* first, const char* last, Func onEdge)
+	{
+		const char* p = first;
+
+		while (p < last)
+		{
+			const char* lineEnd = static_cast<const char*>(memchr(p, '\n', last - p));
+			if (lineEnd == nullptr)
+			{
+				lineEnd = last;
+			}
+
+			while (p < lineEnd && isSpace(*p))
+			{
+				p++;
+			}
+
+			if (p < lineEnd && *p != '#' && *p != '%')
+			{
+				int u = 0;
+				int v = 0;
+				W w = W(1);
+
+				auto result = std::from_chars(p, lineEnd, u);
+				if (result.ec != std::errc() || u < 0)
+				{
+					return false;
+				}
+
+				p = result.ptr;
+				while (p < lineEnd && isSpace(*p))
+				{
+					p++;
+				}
+
+				result = std::from_chars(p, lineEnd, v);
+				if (result.ec != std::errc() || v < 0)
+				{
+					return false;
+				}
+
+				p = result.ptr;
+				while (p < lineEnd && isSpace(*p))
+				{
+					p++;
+				}
+
+				if (p < lineEnd)
+				{
+					result = std::from_chars(p, lineEnd, w);
+					if (result.ec != std::errc())
+					{
+						return false;
+					}
+
+					p = result.ptr;
+					while (p < lineEnd && isSpace(*p))
+					{
+						p++;
+					}
+
+					if (p != lineEnd)
+					{
+						return false;
+					}
+				}
+
+				onEdge(u, v, w);
+			}
+
+			p = lineEnd + 1;
+		}
+
+		return true;
+	}
+
+	//    о   ڸ  func(slices) ȣѴ.
+	// slices[t] ~ slices[t + 1]  t 尡  .
+	template<typename Func>
+	bool forEachChunk(FILE* file, Func func)
+	{
+		std::vector<char> buffer(mChunkBytes);
+		std::vector<const char*> slices(mThreadCount + 1);
+		size_t carry = 0;
+
+		while (true)
+		{
+			size_t read = fread(buffer.data() + carry, 1, buffer.size() - carry, file);
+			if (ferror(file))
+			{
+				return false;
+			}
+
+			size_t length = carry + read;
+			bool eof = read == 0;
+
+			if (eof && length == 0)
+			{
+				break;
+			}
+
+			mStats.bytes += read;
+
+			//   ߷   ѱ.
+			size_t usable = length;
+			if (eof == false)
+			{
+				const char* newline = nullptr;
+				for (size_t i = length; i > 0; i--)
+				{
+					if (buffer[i - 1] == '\n')
+					{
+						newline = buffer.data() + i - 1;
+						break;
+					}
+				}
+
+				if (newline == nullptr)
+				{
+					//    . ۸ ÷ ٽ д´.
+					carry = length;
+					buffer.resize(buffer.size() * 2);
+					continue;
+				}
+
+				usable = newline - buffer.data() + 1;
+			}
+
+			const char* first = buffer.data();
+			const char* last = first + usable;
+
+			slices[0] = first;
+			for (unsigned t = 1; t < mThreadCount; t++)
+			{
+				const char* p = std::max(slices[t - 1], first + usable * t / mThreadCount);
+				const char* newline = p < last ? static_cast<const char*>(memchr(p, '\n', last - p)) : nullptr;
+				slices[t] = newline ? newline + 1 : last;
+			}
+			slices[mThreadCount] = last;
+
+			if (func(slices) == false)
+			{
+				return false;
+			}
+
+			carry = length - usable;
+			memmove(buffer.data(), buffer.data() + usable, carry);
+
+			if (eof)
+			{
+				break;
+			}
+		}
+
+		return true;
+	}
+
+	//  迭 ּ count ĭ ø. (  ۿ ȣ)
+	void growDegrees(size_t count)
+	{
+		if (count <= mDegreeCapacity)
+		{
+			return;
+		}
+
+		size_t capacity = std::max(count, mDegreeCapacity * 2);
+		std::unique_ptr<std::atomic<uint64_t>[]> degrees(new std::atomic<uint64_t>[capacity]);
+
+		for (size_t v = 0; v < capacity; v++)
+		{
+			uint64_t value = v < mDegreeCapacity ? mDegrees[v].load(std::memory_order_relaxed) : 0;
+			degrees[v].store(value, std::memory_order_relaxed);
+		}
+
+		mDegrees = std::move(degrees);
+		mDegreeCapacity = capacity;
+	}
+
+	bool countDegrees(FILE* file, size_t& vertexCount)
+	{
+		long long maxId = -1;
+
+		bool ok = forEachChunk(file, [&](const std::vector<const char*>& slices)
+			{
+				std::atomic<bool> parsed = true;
+
+				//    id ִ밪 𸣹Ƿ    ۿ   Ƶд.
+				// ۴   ٽ Ƿ  Ҵ Ͼ ʴ´.
+				ParallelFor(mPool, 0, mThreadCount, [&](size_t first, size_t last)
+					{
+						for (size_t t = first; t < last; t++)
+						{
+							std::vector<int>& from = mLocalFrom[t];
+							int& localMax = mLocalMax[t];
+							from.clear();
+							localMax = -1;
+
+							bool result = parseLines(slices[t], slices[t + 1], [&](int u, int v, const W&)
+								{
+									from.push_back(u);
+									localMax = std::max(localMax, std::max(u, v));
+								});
+
+							if (result == false)
+							{
+								parsed.store(false);
+							}
+						}
+					});
+
+				if (parsed.load() == false)
+				{
+					return false;
+				}
+
+				for (unsigned t = 0; t < mThreadCount; t++)
+				{
+					maxId = std::max<long long>(maxId, mLocalMax[t]);
+				}
+
+				growDegrees(static_cast<size_t>(maxId + 1));
+
+				ParallelFor(mPool, 0, mThreadCount, [&](size_t first, size_t last)
+					{
+						for (size_t t = first; t < last; t++)
+						{
+							for (int u : mLocalFrom[t])
+							{
+								mDegrees[u].fetch_add(1, std::memory_order_relaxed);
+							}
+						}
+					});
+
+				return true;
+			});
+
+		vertexCount = static_cast<size_t>(maxId + 1);
+		growDegrees(vertexCount);
+		return ok;
+	}
+
+	bool scatterEdges(FILE* file,
+		const std::vector<typename CSRGraph<W>::offset_type>& offsets,
+		std::vector<typename CSRGraph<W>::vertex_type>& targets,
+		std::vector<W>& weights)
+	{
+		const size_t vertexCount = offsets.size() - 1;
+
+		return forEachChunk(file, [&](const std::vector<const char*>& slices)
+			{
+				std::atomic<bool> parsed = true;
+
+				ParallelFor(mPool, 0, mThreadCount, [&](size_t first, size_t last)
+					{
+						for (size_t t = first; t < last; t++)
+						{
+							bool inRange = true;
+
+							bool result = parseLines(slices[t], slices[t + 1], [&](int u, int v, const W& w)
+								{
+									//   д   ٲ ڸ ڶ  ִ.
+									if (static_cast<size_t>(u) >= vertexCount || static_cast<size_t>(v) >= vertexCount)
+									{
+										inRange = false;
+										return;
+									}
+
+									uint64_t pos = mDegrees[u].fetch_add(1, std::memory_order_relaxed);
+									if (pos >= offsets[u + 1])
+									{
+										inRange = false;
+										return;
+									}
+
+									targets[pos] = v;
+									weights[pos] = w;
+								});
+
+							if (result == false || inRange == false)
+							{
+								parsed.store(false);
+							}
+						}
+					});
+
+				return parsed.load();
+			});
+	}
+
+private:
+	size_t mChunkBytes;
+	unsigned mThreadCount;
+	ThreadPool mPool;
+
+	std::vector<std::vector<int>> mLocalFrom;
+	std::vector<int> mLocalMax;
+
+	std::unique_ptr<std::atomic<uint64_t>[]> mDegrees;
+	size_t mDegreeCapacity = 0;
+
+	EdgeListLoadStats mStats;
+};
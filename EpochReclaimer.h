@@ -0,0 +1,256 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ũ  ޸ ȸ (Epoch-Based Reclamation, Fraser)
+//   ڷᱸ  带 ٸ 尡  а   Ƿ ٷ  Ѵ.
+// - а   EpochGuard  θ 尡   ũ ˸.
+// -   retire ׶ ũ Բ  Ͽ ִ´.
+// -  ȿ ִ  尡  ũ ˷   ũ ϳ .
+//   ׷ ũ e    ũ e + 2 Ǹ      ȴ.
+//
+// μ ϳ (instance)̰  ڷᱸ Բ .   Լ Բ ѱǷ
+// ڷᱸ   ߿   ִ.  ȿ   尡  ȸ .
+class EpochReclaimer
+{
+public:
+	using Deleter = void (*)(void*);
+
+	//   retire  ũ ø   ִ 带 .
+	static constexpr size_t CollectInterval = 64;
+
+	static EpochReclaimer& instance()
+	{
+		static EpochReclaimer reclaimer;
+		return reclaimer;
+	}
+
+	EpochReclaimer(const EpochReclaimer&) = delete;
+	EpochReclaimer& operator=(const EpochReclaimer&) = delete;
+
+	// destructor
+
+	~EpochReclaimer()
+	{
+		ThreadRecord* record = mRecords.load(std::memory_order_acquire);
+
+		while (record != nullptr)
+		{
+			ThreadRecord* next = record->next;
+			freeRetired(*record, UINT64_MAX);
+			delete record;
+			record = next;
+		}
+	}
+
+	//
+
+	//  ĵ ȴ.  ٱ  ũ ˸.
+	void enter()
+	{
+		ThreadRecord& record = localRecord();
+
+		if (record.nesting++ > 0)
+		{
+			return;
+		}
+
+		// ˸ ̿ ũ ö ٽ ˸.
+		uint64_t epoch = mEpoch.load(std::memory_order_seq_cst);
+
+		while (true)
+		{
+			record.state.store((epoch << 1) | ActiveBit, std::memory_order_seq_cst);
+
+			const uint64_t current = mEpoch.load(std::memory_order_seq_cst);
+			if (current == epoch)
+			{
+				break;
+			}
+
+			epoch = current;
+		}
+	}
+
+	void exit()
+	{
+		ThreadRecord& record = localRecord();
+		assert(record.nesting > 0);
+
+		if (--record.nesting == 0)
+		{
+			record.state.store(0, std::memory_order_release);
+		}
+	}
+
+	// ڷᱸ   带 ѱ. ƹ    Ǹ deleter(node) θ.
+	void retire(void* node, Deleter deleter)
+	{
+		ThreadRecord& record = localRecord();
+		record.retired.push_back({ node, deleter, mEpoch.load(std::memory_order_seq_cst) });
+
+		if (++record.retiredSinceCollect >= CollectInterval)
+		{
+			collect();
+		}
+	}
+
+	// ũ ÷    Ͽ   ִ 带 .
+	void collect()
+	{
+		ThreadRecord& record = localRecord();
+		record.retiredSinceCollect = 0;
+
+		tryAdvance();
+
+		const uint64_t epoch = mEpoch.load(std::memory_order_seq_cst);
+		if (epoch >= 2)
+		{
+			freeRetired(record, epoch - 2);
+		}
+	}
+
+	inline uint64_t epoch() const
+	{
+		return mEpoch.load(std::memory_order_relaxed);
+	}
+
+private:
+	EpochReclaimer() = default;
+
+	static constexpr uint64_t ActiveBit = 1;
+
+	struct Retired
+	{
+		void* node;
+		Deleter deleter;
+		uint64_t epoch; // retire   ũ
+	};
+
+	// 帶 ϳ. 尡  ٸ 尡 ̾ . ( 嵵 Բ)
+	// ٸ 尡 state Ƿ ĳ   .
+	struct alignas(64) ThreadRecord
+	{
+		std::atomic<uint64_t> state = 0; // (˸ ũ << 1) | ActiveBit,  ̸ 0
+		std::atomic<bool> inUse = false;
+		ThreadRecord* next = nullptr;    // Ͽ  ڿ ٲ ʴ´.
+
+		//  常 .
+		unsigned nesting = 0;
+		size_t retiredSinceCollect = 0;
+		std::vector<Retired> retired;    // epoch 
+	};
+
+	// 尡    ش.
+	struct LocalSlot
+	{
+		ThreadRecord* record = nullptr;
+
+		~LocalSlot()
+		{
+			if (record != nullptr)
+			{
+				record->inUse.store(false, std::memory_order_release);
+			}
+		}
+	};
+
+	ThreadRecord& localRecord()
+	{
+		static thread_local LocalSlot slot;
+
+		if (slot.record == nullptr)
+		{
+			slot.record = acquireRecord();
+		}
+
+		return *slot.record;
+	}
+
+	//    ã     տ ִ´.   ʴ´.
+	ThreadRecord* acquireRecord()
+	{
+		for (ThreadRecord* record = mRecords.load(std::memory_order_acquire); record != nullptr; record = record->next)
+		{
+			bool expected = false;
+			if (record->inUse.load(std::memory_order_relaxed) == false &&
+				record->inUse.compare_exchange_strong(expected, true, std::memory_order_acquire))
+			{
+				return record;
+			}
+		}
+
+		ThreadRecord* record = new ThreadRecord();
+		record->inUse.store(true, std::memory_order_relaxed);
+
+		ThreadRecord* head = mRecords.load(std::memory_order_relaxed);
+		do
+		{
+			record->next = head;
+		} while (mRecords.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed) == false);
+
+		return record;
+	}
+
+	//   尡   ũ ˷ ϳ ø.
+	void tryAdvance()
+	{
+		uint64_t epoch = mEpoch.load(std::memory_order_seq_cst);
+
+		for (ThreadRecord* record = mRecords.load(std::memory_order_acquire); record != nullptr; record = record->next)
+		{
+			const uint64_t state = record->state.load(std::memory_order_seq_cst);
+
+			if ((state & ActiveBit) != 0 && (state >> 1) != epoch)
+			{
+				return;
+			}
+		}
+
+		mEpoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+	}
+
+	// epoch Ͽ retire 带 .
+	static void freeRetired(ThreadRecord& record, uint64_t epoch)
+	{
+		size_t count = 0;
+
+		while (count < record.retired.size() && record.retired[count].epoch <= epoch)
+		{
+			record.retired[count].deleter(record.retired[count].node);
+			count++;
+		}
+
+		record.retired.erase(record.retired.begin(), record.retired.begin() + count);
+	}
+
+private:
+	std::atomic<uint64_t> mEpoch = 0;
+	std::atomic<ThreadRecord*> mRecords = nullptr;
+};
+
+// ڷᱸ а    尡 ũ  ȿ ְ Ѵ.
+class EpochGuard
+{
+public:
+	EpochGuard()
+		: mReclaimer(EpochReclaimer::instance())
+	{
+		mReclaimer.enter();
+	}
+
+	EpochGuard(const EpochGuard&) = delete;
+	EpochGuard& operator=(const EpochGuard&) = delete;
+
+	~EpochGuard()
+	{
+		mReclaimer.exit();
+	}
+
+private:
+	EpochReclaimer& mReclaimer;
+};
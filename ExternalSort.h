@@ -0,0 +1,610 @@
+#pragma once
+
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <future>
+#include <memory>
+#include <random>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include "PriorityQueue.h"
+#include "ThreadPool.h"
+#include "sort.h"
+
+struct ExternalSortStats
+{
+	size_t bytes = 0;         // Է  ũ
+	size_t runs = 0;          // 1) ܰ迡   
+	size_t mergePasses = 0;   // 2) ܰ迡  ü   Ⱦ
+	size_t mergeFanIn = 0;    // 2) ܰ迡   ĥ  ִ  
+	size_t ioBufferBytes = 0; //     ũ (޸ ѵ  ٿ  ִ)
+	size_t mergeBytes = 0;    // 2) ܰ迡  Ʈ  ( ȸ )
+	double runSeconds = 0;    // 1)  
+	double mergeSeconds = 0;  // 2) 
+
+	inline double seconds() const
+	{
+		return runSeconds + mergeSeconds;
+	}
+
+	inline double run_bytes_per_second() const
+	{
+		return runSeconds > 0 ? bytes / runSeconds : 0;
+	}
+
+	inline double merge_bytes_per_second() const
+	{
+		return mergeSeconds > 0 ? mergeBytes / mergeSeconds : 0;
+	}
+};
+
+//   ڵ带 д´.
+//       ٸ 忡 ̸ од. ( )
+template<typename T>
+class ExternalRecordReader
+{
+public:
+	ExternalRecordReader() = default;
+	ExternalRecordReader(const ExternalRecordReader&) = delete;
+	ExternalRecordReader& operator=(const ExternalRecordReader&) = delete;
+
+	~ExternalRecordReader()
+	{
+		close();
+	}
+
+	bool open(const std::string& path, size_t blockRecords)
+	{
+		mFile = fopen(path.c_str(), "rb");
+		if (mFile == nullptr)
+		{
+			return false;
+		}
+
+		mCurrent.resize(blockRecords);
+		mNext.resize(blockRecords);
+		mSize = 0;
+		mPos = 0;
+
+		startRead();
+		return true;
+	}
+
+	void close()
+	{
+		if (mPending.valid())
+		{
+			mPending.wait();
+		}
+
+		if (mFile != nullptr)
+		{
+			fclose(mFile);
+			mFile = nullptr;
+		}
+	}
+
+	//  ڵ. ̸ false.
+	inline bool read(T& record)
+	{
+		if (mPos == mSize && refill() == false)
+		{
+			return false;
+		}
+
+		record = mCurrent[mPos++];
+		return true;
+	}
+
+	inline bool failed() const
+	{
+		return mFailed;
+	}
+
+private:
+	void startRead()
+	{
+		mPending = std::async(std::launch::async, [this]()
+			{
+				return fread(mNext.data(), sizeof(T), mNext.size(), mFile);
+			});
+	}
+
+	bool refill()
+	{
+		if (mPending.valid() == false)
+		{
+			return false;
+		}
+
+		size_t count = mPending.get();
+
+		//   ä   ̰ų .   ʴ´.
+		if (count < mNext.size() && ferror(mFile))
+		{
+			mFailed = true;
+			return false;
+		}
+
+		if (count == 0)
+		{
+			return false;
+		}
+
+		mCurrent.swap(mNext);
+		mSize = count;
+		mPos = 0;
+
+		if (count == mCurrent.size())
+		{
+			startRead();
+		}
+
+		return true;
+	}
+
+private:
+	FILE* mFile = nullptr;
+	std::vector<T> mCurrent;
+	std::vector<T> mNext;
+	size_t mSize = 0;
+	size_t mPos = 0;
+	std::future<size_t> mPending;
+	bool mFailed = false;
+};
+
+//   ڵ带 .
+//    ٸ 忡  ׵   ä. ( )
+template<typename T>
+class ExternalRecordWriter
+{
+public:
+	ExternalRecordWriter() = default;
+	ExternalRecordWriter(const ExternalRecordWriter&) = delete;
+	ExternalRecordWriter& operator=(const ExternalRecordWriter&) = delete;
+
+	~ExternalRecordWriter()
+	{
+		close();
+	}
+
+	bool open(const std::string& path, size_t blockRecords)
+	{
+		mFile = fopen(path.c_str(), "wb");
+		if (mFile == nullptr)
+		{
+			return false;
+		}
+
+		mBlockRecords = blockRecords;
+		mCurrent.reserve(blockRecords);
+		mNext.reserve(blockRecords);
+		mFailed = false;
+		return true;
+	}
+
+	inline void write(const T& record)
+	{
+		mCurrent.push_back(record);
+
+		if (mCurrent.size() == mBlockRecords)
+		{
+			flush();
+		}
+	}
+
+	// ĵ ó ̹ ޸𸮿 ִ ū 迭 ۸ ġ ʰ ٷ .
+	void write(const T* records, size_t count)
+	{
+		flush();
+		wait();
+
+		if (fwrite(records, sizeof(T), count, mFile) != count)
+		{
+			mFailed = true;
+		}
+	}
+
+	//  false
+	bool close()
+	{
+		if (mFile == nullptr)
+		{
+			return mFailed == false;
+		}
+
+		flush();
+		wait();
+
+		if (fclose(mFile) != 0)
+		{
+			mFailed = true;
+		}
+
+		mFile = nullptr;
+		return mFailed == false;
+	}
+
+private:
+	void wait()
+	{
+		if (mPending.valid() && mPending.get() == false)
+		{
+			mFailed = true;
+		}
+	}
+
+	void flush()
+	{
+		if (mCurrent.empty())
+		{
+			return;
+		}
+
+		wait();
+		mCurrent.swap(mNext);
+		mCurrent.clear();
+
+		mPending = std::async(std::launch::async, [this]()
+			{
+				return fwrite(mNext.data(), sizeof(T), mNext.size(), mFile) == mNext.size();
+			});
+	}
+
+private:
+	FILE* mFile = nullptr;
+	size_t mBlockRecords = 0;
+	std::vector<T> mCurrent;
+	std::vector<T> mNext;
+	std::future<bool> mPending;
+	bool mFailed = false;
+};
+
+// ܺ 
+// ޸𸮿   ʴ   ڵ  Ѵ. (T ڵ ϳ,  T ״ ̾  )
+// 1)   : ޸ ѵ ݾ о ParallelQuickSort   ӽ Ϸ .
+//                 ϰ   ̸ д´.
+// 2)      :  ϳ  ڵ带  (PriorityQueue.h) ְ     ä.
+//                б    ʿϹǷ   ĥ  ִ   ޸ ѵ ,
+//                ׺     ģ.
+//  ioBufferBytes ũ  б, ⸸ Ѵ.
+// տ  MergeFanInTarget  ۰ ޸ ѵ  ioBufferBytes δ.
+//   ȿ   ƴϴ.
+template<typename T, typename Compare = std::less<T>>
+class ExternalSorter
+{
+	static_assert(std::is_trivially_copyable_v<T>, "external sort needs fixed-width records");
+
+public:
+	// ޸ ѵ ۾Ƶ   ̸ŭ ġ  ۸ δ.
+	static constexpr size_t MergeFanInTarget = 8;
+
+	// tempDirectory   ý ӽ ͸
+	explicit ExternalSorter(size_t memoryBytes = size_t(256) << 20,
+		const std::string& tempDirectory = std::string(),
+		unsigned threadCount = 0,
+		size_t ioBufferBytes = size_t(4) << 20,
+		const Compare& compare = Compare())
+		: mMemoryBytes(std::max(memoryBytes, 6 * sizeof(T)))
+		, mIoBufferBytes(std::max(std::min(ioBufferBytes, mMemoryBytes / (2 * (MergeFanInTarget + 1))), sizeof(T)))
+		, mTempDirectory(tempDirectory)
+		, mTempRandom(std::random_device()())
+		, mPool(threadCount)
+		, mCompare(compare)
+	{}
+
+	// input  output . ϸ ( , ũⰡ ڵ  ƴ,  ) false.
+	// ӽ  , п  .
+	bool Sort(const std::string& input, const std::string& output)
+	{
+		mStats = ExternalSortStats();
+		mStats.ioBufferBytes = mIoBufferBytes;
+
+		std::error_code error;
+		uintmax_t size = std::filesystem::file_size(input, error);
+		if (error || size % sizeof(T) != 0)
+		{
+			return false;
+		}
+
+		mStats.bytes = static_cast<size_t>(size);
+
+		if (mTempDirectory.empty())
+		{
+			mTempDirectory = std::filesystem::temp_directory_path(error).string();
+			if (error)
+			{
+				return false;
+			}
+		}
+
+		std::vector<std::string> runs;
+		bool ok = makeRuns(input, output, runs);
+
+		if (ok && runs.empty() == false)
+		{
+			ok = mergeAll(runs, output);
+		}
+
+		for (const auto& run : runs)
+		{
+			std::filesystem::remove(run, error);
+		}
+
+		return ok;
+	}
+
+	inline const ExternalSortStats& stats() const noexcept
+	{
+		return mStats;
+	}
+
+private:
+	//  .  ̸     .
+	struct HeapEntry
+	{
+		T value;
+		size_t run;
+	};
+
+	// PriorityQueue  a b ڿ ; ϸ true (   )
+	struct HeapOrder
+	{
+		Compare compare;
+
+		inline bool operator()(const HeapEntry& a, const HeapEntry& b) const
+		{
+			if (compare(b.value, a.value))
+			{
+				return true;
+			}
+
+			return compare(a.value, b.value) == false && a.run > b.run;
+		}
+	};
+
+	//  ӽ     θ ش. ϸ  ڿ
+	//  ͸  ٸ μ, ٸ ı   ʵ ̸   ְ
+	// Ÿ ("wbx") . ̹ ִ ̸̸ ٸ ̸ ٽ .
+	std::string createTempFile()
+	{
+		for (int attempt = 0; attempt < 16; attempt++)
+		{
+			std::filesystem::path path(mTempDirectory);
+			path /= "extsort_" + std::to_string(mTempRandom()) + "_" + std::to_string(mTempCount++) + ".run";
+
+			FILE* file = fopen(path.string().c_str(), "wbx");
+			if (file != nullptr)
+			{
+				fclose(file);
+				return path.string();
+			}
+
+			if (errno != EEXIST)
+			{
+				break;
+			}
+		}
+
+		return std::string();
+	}
+
+	inline size_t blockRecords() const
+	{
+		return std::max<size_t>(1, mIoBufferBytes / sizeof(T));
+	}
+
+	// Է    ũ⺸  ٷ output  runs д.
+	bool makeRuns(const std::string& input, const std::string& output, std::vector<std::string>& runs)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		FILE* file = fopen(input.c_str(), "rb");
+		if (file == nullptr)
+		{
+			return false;
+		}
+
+		const size_t runRecords = std::max<size_t>(1, mMemoryBytes / 2 / sizeof(T));
+		const bool single = mStats.bytes <= runRecords * sizeof(T);
+
+		std::vector<T> current(runRecords);
+		std::vector<T> next(runRecords);
+
+		auto readChunk = [file](std::vector<T>& chunk)
+		{
+			return fread(chunk.data(), sizeof(T), chunk.size(), file);
+		};
+
+		bool ok = true;
+		size_t count = readChunk(current);
+
+		while (count > 0)
+		{
+			// ϰ     д´.
+			std::future<size_t> pending;
+			if (count == runRecords && single == false)
+			{
+				pending = std::async(std::launch::async, readChunk, std::ref(next));
+			}
+
+			ParallelQuickSort(mPool, current.begin(), current.begin() + count, mCompare);
+
+			std::string path = single ? output : createTempFile();
+			if (path.empty())
+			{
+				ok = false;
+				break;
+			}
+
+			if (single == false)
+			{
+				runs.push_back(path);
+			}
+
+			ExternalRecordWriter<T> writer;
+			ok = writer.open(path, blockRecords());
+			if (ok)
+			{
+				writer.write(current.data(), count);
+				ok = writer.close();
+			}
+
+			count = pending.valid() ? pending.get() : 0;
+
+			if (ok == false)
+			{
+				break;
+			}
+
+			current.swap(next);
+		}
+
+		if (ferror(file))
+		{
+			ok = false;
+		}
+
+		fclose(file);
+
+		//  Էµ    .
+		if (ok && mStats.bytes == 0)
+		{
+			ExternalRecordWriter<T> writer;
+			ok = writer.open(output, 1) && writer.close();
+		}
+
+		mStats.runs = single ? 1 : runs.size();
+		mStats.runSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		return ok;
+	}
+
+	// inputs ϳ  output .
+	bool mergeRuns(const std::vector<std::string>& inputs, size_t first, size_t last, const std::string& output)
+	{
+		const size_t k = last - first;
+
+		std::vector<std::unique_ptr<ExternalRecordReader<T>>> readers(k);
+		std::vector<HeapEntry> heap;
+		heap.reserve(k);
+
+		for (size_t i = 0; i < k; i++)
+		{
+			readers[i] = std::make_unique<ExternalRecordReader<T>>();
+			if (readers[i]->open(inputs[first + i], blockRecords()) == false)
+			{
+				return false;
+			}
+
+			HeapEntry entry;
+			entry.run = i;
+			if (readers[i]->read(entry.value))
+			{
+				heap.push_back(entry);
+			}
+		}
+
+		ExternalRecordWriter<T> writer;
+		if (writer.open(output, blockRecords()) == false)
+		{
+			return false;
+		}
+
+		HeapOrder order{ mCompare };
+		MakeHeap(heap.begin(), heap.end(), order);
+
+		// ⸦     ڵ ٷ ٲ ִ´. (pop + push    δ)
+		while (heap.empty() == false)
+		{
+			writer.write(heap[0].value);
+			mStats.mergeBytes += sizeof(T);
+
+			if (readers[heap[0].run]->read(heap[0].value) == false)
+			{
+				PopHeap(heap.begin(), heap.end(), order);
+				heap.pop_back();
+				continue;
+			}
+
+			HeapSiftDown(heap.begin(), 0, heap.size(), order);
+		}
+
+		bool ok = writer.close();
+
+		for (const auto& reader : readers)
+		{
+			if (reader->failed())
+			{
+				ok = false;
+			}
+		}
+
+		return ok;
+	}
+
+	bool mergeAll(std::vector<std::string>& runs, const std::string& output)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		//  б  2, ¿ 2
+		const size_t buffers = mMemoryBytes / (2 * mIoBufferBytes);
+		const size_t fanIn = buffers > 2 ? buffers - 1 : 2;
+		bool ok = true;
+
+		mStats.mergeFanIn = fanIn;
+
+		while (ok && runs.size() > fanIn)
+		{
+			std::vector<std::string> merged;
+
+			for (size_t first = 0; ok && first < runs.size(); first += fanIn)
+			{
+				size_t last = std::min(runs.size(), first + fanIn);
+				std::string path = createTempFile();
+				if (path.empty())
+				{
+					ok = false;
+					break;
+				}
+
+				merged.push_back(path);
+				ok = mergeRuns(runs, first, last, path);
+			}
+
+			std::error_code error;
+			for (const auto& run : runs)
+			{
+				std::filesystem::remove(run, error);
+			}
+
+			runs.swap(merged);
+			mStats.mergePasses++;
+		}
+
+		if (ok)
+		{
+			ok = mergeRuns(runs, 0, runs.size(), output);
+			mStats.mergePasses++;
+		}
+
+		mStats.mergeSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		return ok;
+	}
+
+private:
+	size_t mMemoryBytes;
+	size_t mIoBufferBytes;
+	std::string mTempDirectory;
+	size_t mTempCount = 0;
+	std::mt19937_64 mTempRandom;
+
+	ThreadPool mPool;
+	Compare mCompare;
+
+	ExternalSortStats mStats;
+};
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "Parallel.h"
+
+// ÷̵- ˰ (   ִ Ÿ)
+// dist[i * n + j] : i -> j Ÿ ( 켱 n * n )
+// O(N^3)
+
+//     Ÿ.
+//    ص ġ ʵ ִ밪  Ѵ.
+template<typename W>
+constexpr W FloydWarshallInfinity()
+{
+	if constexpr (std::numeric_limits<W>::has_infinity)
+	{
+		return std::numeric_limits<W>::infinity();
+	}
+	else
+	{
+		return std::numeric_limits<W>::max() / 2;
+	}
+}
+
+//  ϳ ϴ min-plus Ŀ.
+// [i0, i1) x [j0, j1)  k in [k0, k1)  ϴ η Ѵ.
+// j  б  ӵ ޸𸮸 ȱ  Ϸ SIMD ȭѴ.
+template<typename W>
+void FloydWarshallBlock(W* dist, size_t n,
+	size_t i0, size_t i1, size_t j0, size_t j1, size_t k0, size_t k1)
+{
+	const W inf = FloydWarshallInfinity<W>();
+
+	for (size_t k = k0; k < k1; k++)
+	{
+		const W* rowK = dist + k * n;
+
+		for (size_t i = i0; i < i1; i++)
+		{
+			W* rowI = dist + i * n;
+			const W dik = rowI[k];
+
+			// i -> k ΰ    .
+			if (dik >= inf)
+			{
+				continue;
+			}
+
+			for (size_t j = j0; j < j1; j++)
+			{
+				W candidate = rowK[j] >= inf ? inf : dik + rowK[j];
+				rowI[j] = candidate < rowI[j] ? candidate : rowI[j];
+			}
+		}
+	}
+}
+
+// ĳ   ÷̵-
+//  ũ B  k ϸ
+// 1) 밢  (k, k)
+// 2) k   (k, j)   (i, k)  -> ϳ ̹Ƿ 
+// 3)   (i, j)             -> ϳ ̹Ƿ 
+//  Ѵ.  (3 * B * B) ĳÿ ӹ   .
+template<typename W>
+void FloydWarshall(ThreadPool& pool, std::vector<W>& dist, size_t n, size_t blockSize = 64)
+{
+	if (n == 0)
+	{
+		return;
+	}
+
+	W* d = dist.data();
+	const size_t blocks = (n + blockSize - 1) / blockSize;
+
+	auto blockBegin = [blockSize](size_t b) { return b * blockSize; };
+	auto blockEnd = [blockSize, n](size_t b) { return std::min(n, (b + 1) * blockSize); };
+
+	for (size_t kb = 0; kb < blocks; kb++)
+	{
+		const size_t k0 = blockBegin(kb);
+		const size_t k1 = blockEnd(kb);
+
+		// 1) 밢 
+		FloydWarshallBlock(d, n, k0, k1, k0, k1, k0, k1);
+
+		// 2) k   
+		ParallelFor(pool, 0, blocks, [&](size_t first, size_t last)
+			{
+				for (size_t b = first; b < last; b++)
+				{
+					if (b == kb)
+					{
+						continue;
+					}
+
+					FloydWarshallBlock(d, n, k0, k1, blockBegin(b), blockEnd(b), k0, k1);
+					FloydWarshallBlock(d, n, blockBegin(b), blockEnd(b), k0, k1, k0, k1);
+				}
+			});
+
+		// 3)   (   й)
+		ParallelFor(pool, 0, blocks, [&](size_t first, size_t last)
+			{
+				for (size_t ib = first; ib < last; ib++)
+				{
+					if (ib == kb)
+					{
+						continue;
+					}
+
+					for (size_t jb = 0; jb < blocks; jb++)
+					{
+						if (jb == kb)
+						{
+							continue;
+						}
+
+						FloydWarshallBlock(d, n, blockBegin(ib), blockEnd(ib), blockBegin(jb), blockEnd(jb), k0, k1);
+					}
+				}
+			});
+	}
+}
+
+template<typename W>
+void FloydWarshall(std::vector<W>& dist, size_t n, size_t blockSize = 64, unsigned threadCount = 0)
+{
+	ThreadPool pool(threadCount);
+	FloydWarshall(pool, dist, n, blockSize);
+}
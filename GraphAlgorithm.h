@@ -0,0 +1,338 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <vector>
+#include "DisjointSet.h"
+#include "IndexedPriorityQueue.h"
+#include "Parallel.h"
+
+//  id ׷ (CSRGraph )  ϴ ׷ ˰
+// Graph size(), begin(v), end(v)  ؾ Ѵ.
+
+// ǥ   ó   0 ~ k-1  ٽ ű.
+inline std::vector<int> CompactLabels(const std::vector<int>& roots)
+{
+	std::vector<int> ids(roots.size(), -1);
+	std::vector<int> labels(roots.size());
+	int count = 0;
+
+	for (size_t v = 0; v < roots.size(); v++)
+	{
+		int& id = ids[roots[v]];
+		if (id == -1)
+		{
+			id = count++;
+		}
+
+		labels[v] = id;
+	}
+
+	return labels;
+}
+
+//   (  )
+// Union-Find    ģ.
+// ȯ :   ȣ (0,   ó  Һ ȣ ű)
+// O(V + E * (V))
+template<typename Graph>
+std::vector<int> ConnectedComponents(const Graph& g)
+{
+	const size_t n = g.size();
+	DisjointSet set(n);
+
+	for (size_t u = 0; u < n; u++)
+	{
+		for (auto it = g.begin(static_cast<int>(u)); it != g.end(static_cast<int>(u)); ++it)
+		{
+			set.Merge(static_cast<int>(u), *it);
+		}
+	}
+
+	std::vector<int> roots(n);
+	for (size_t v = 0; v < n; v++)
+	{
+		roots[v] = set.Find(static_cast<int>(v));
+	}
+
+	return CompactLabels(roots);
+}
+
+// atomic  value  ũ value  .  true.
+inline bool AtomicMin(std::atomic<int>& target, int value)
+{
+	int current = target.load(std::memory_order_relaxed);
+
+	while (value < current)
+	{
+		if (target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+//  ķ ϴ   ()
+//    ڱ id        ߴ 
+//  ̻ ٲ   ݺѴ.  ݺ   󺧷 ǳʶپ(pointer jumping)
+//  ο ݺ Ƚ δ.
+//  ConnectedComponents .
+template<typename Graph>
+std::vector<int> LabelPropagationComponents(ThreadPool& pool, const Graph& g)
+{
+	const size_t n = g.size();
+	std::vector<std::atomic<int>> labels(n);
+
+	for (size_t v = 0; v < n; v++)
+	{
+		labels[v].store(static_cast<int>(v), std::memory_order_relaxed);
+	}
+
+	std::atomic<bool> changed = true;
+	while (changed.load())
+	{
+		changed.store(false);
+
+		ParallelFor(pool, 0, n, [&](size_t first, size_t last)
+			{
+				bool localChanged = false;
+
+				for (size_t u = first; u < last; u++)
+				{
+					for (auto it = g.begin(static_cast<int>(u)); it != g.end(static_cast<int>(u)); ++it)
+					{
+						int lu = labels[u].load(std::memory_order_relaxed);
+						int lv = labels[*it].load(std::memory_order_relaxed);
+
+						if (lu < lv)
+						{
+							localChanged |= AtomicMin(labels[*it], lu);
+						}
+						else if (lv < lu)
+						{
+							localChanged |= AtomicMin(labels[u], lv);
+						}
+					}
+				}
+
+				if (localChanged)
+				{
+					changed.store(true);
+				}
+			});
+
+		//  ׻  ҿ     id ̹Ƿ   󺧷 ٷ ǳʶ  ִ.
+		ParallelFor(pool, 0, n, [&](size_t first, size_t last)
+			{
+				for (size_t v = first; v < last; v++)
+				{
+					int label = labels[v].load(std::memory_order_relaxed);
+					int next = labels[label].load(std::memory_order_relaxed);
+
+					while (next < label)
+					{
+						label = next;
+						next = labels[label].load(std::memory_order_relaxed);
+					}
+
+					AtomicMin(labels[v], label);
+				}
+			});
+	}
+
+	std::vector<int> roots(n);
+	for (size_t v = 0; v < n; v++)
+	{
+		roots[v] = labels[v].load(std::memory_order_relaxed);
+	}
+
+	return CompactLabels(roots);
+}
+
+template<typename Graph>
+std::vector<int> LabelPropagationComponents(const Graph& g, unsigned threadCount = 0)
+{
+	ThreadPool pool(threadCount);
+	return LabelPropagationComponents(pool, g);
+}
+
+// ͽƮ ˰ (    ִ Ÿ)
+// ġ  ƴ ׷ (weight_begin(v) ʿ)    Ÿ ȮѴ.
+// ť  ϳ ĺ ΰ  ª θ ã  ڸ  δ. (IndexedPriorityQueue)
+// ȯ :  sourceκ Ÿ.    unreachable
+// O(ElogV)
+template<typename Graph>
+std::vector<typename Graph::weight_type> Dijkstra(const Graph& g, int source,
+	typename Graph::weight_type unreachable = std::numeric_limits<typename Graph::weight_type>::max())
+{
+	using W = typename Graph::weight_type;
+
+	const size_t n = g.size();
+	std::vector<W> dist(n, unreachable);
+	std::vector<bool> done(n, false);
+	IndexedPriorityQueue<W, std::greater<W>> pq(n);
+
+	pq.push(source, W());
+
+	while (pq.empty() == false)
+	{
+		const int u = static_cast<int>(pq.top_index());
+		const W cost = pq.top();
+		pq.pop();
+
+		dist[u] = cost;
+		done[u] = true;
+
+		const W* weight = g.weight_begin(u);
+		for (auto it = g.begin(u); it != g.end(u); ++it, ++weight)
+		{
+			if (done[*it] == false)
+			{
+				pq.push_or_improve(*it, cost + *weight);
+			}
+		}
+	}
+
+	return dist;
+}
+
+//   (Kahn ˰)
+//   0       .
+// Ŭ  false ȯϰ order    .
+// O(V + E)
+template<typename Graph>
+bool TopologicalSort(const Graph& g, std::vector<int>& order)
+{
+	const size_t n = g.size();
+	std::vector<size_t> inDegree(n, 0);
+
+	for (size_t u = 0; u < n; u++)
+	{
+		for (auto it = g.begin(static_cast<int>(u)); it != g.end(static_cast<int>(u)); ++it)
+		{
+			inDegree[*it]++;
+		}
+	}
+
+	// order ü ť Ѵ. [head, order.size())  ť  .
+	order.clear();
+	order.reserve(n);
+
+	for (size_t v = 0; v < n; v++)
+	{
+		if (inDegree[v] == 0)
+		{
+			order.push_back(static_cast<int>(v));
+		}
+	}
+
+	for (size_t head = 0; head < order.size(); head++)
+	{
+		int u = order[head];
+
+		for (auto it = g.begin(u); it != g.end(u); ++it)
+		{
+			if (--inDegree[*it] == 0)
+			{
+				order.push_back(*it);
+			}
+		}
+	}
+
+	return order.size() == n;
+}
+
+//    (Tarjan ˰)
+//  켱 Ž   ÿ װ, ڽź  湮  ư  
+// (low == index)     ϳ ҷ .
+// ū ׷  ġ ʵ     Ѵ.
+// ȯ :   ȣ. ȣ  ׷   ̴.
+// O(V + E)
+template<typename Graph>
+std::vector<int> StronglyConnectedComponents(const Graph& g)
+{
+	using EdgeIterator = decltype(g.begin(0));
+
+	struct Frame
+	{
+		int vertex;
+		EdgeIterator next;
+	};
+
+	const size_t n = g.size();
+	std::vector<int> index(n, -1);
+	std::vector<int> low(n, 0);
+	std::vector<int> component(n, -1);
+	std::vector<int> stack;
+	std::vector<Frame> callStack;
+	int counter = 0;
+	int componentCount = 0;
+
+	auto visit = [&](int v)
+		{
+			index[v] = low[v] = counter++;
+			stack.push_back(v);
+			callStack.push_back(Frame{ v, g.begin(v) });
+		};
+
+	for (size_t s = 0; s < n; s++)
+	{
+		if (index[s] != -1)
+		{
+			continue;
+		}
+
+		visit(static_cast<int>(s));
+
+		while (callStack.empty() == false)
+		{
+			Frame& frame = callStack.back();
+			int v = frame.vertex;
+
+			if (frame.next != g.end(v))
+			{
+				int w = *frame.next;
+				++frame.next;
+
+				if (index[w] == -1)
+				{
+					visit(w);
+				}
+				else if (component[w] == -1)
+				{
+					//  ÿ ִ 
+					low[v] = std::min(low[v], index[w]);
+				}
+
+				continue;
+			}
+
+			callStack.pop_back();
+
+			if (low[v] == index[v])
+			{
+				int w;
+				do
+				{
+					w = stack.back();
+					stack.pop_back();
+					component[w] = componentCount;
+				} while (w != v);
+
+				componentCount++;
+			}
+
+			if (callStack.empty() == false)
+			{
+				int parent = callStack.back().vertex;
+				low[parent] = std::min(low[parent], low[v]);
+			}
+		}
+	}
+
+	return component;
+}
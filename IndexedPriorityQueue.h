@@ -0,0 +1,202 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+// ε 켱 ť
+// 0 ~ capacity-1  ε  ϳ ,  ȿ  ε ġ Ѵ.
+// п ̹ ִ ε  O(logN) ٲ  ִ. (ͽƮ,  decrease-key)
+// PriorityQueue  Compare std::less  ū  top.
+template<typename T, typename Compare = std::less<T>>
+class IndexedPriorityQueue
+{
+public:
+
+	// constructor
+
+	explicit IndexedPriorityQueue(size_t capacity, const Compare& compare = Compare())
+		: mHeap()
+		, mPosition(capacity, npos)
+		, mValues(capacity)
+		, mCompare(compare)
+	{}
+
+	//
+
+	// Element access
+
+	inline const T& top() const
+	{
+		assert(mHeap.empty() == false);
+
+		return mValues[mHeap.front()];
+	}
+
+	inline size_t top_index() const
+	{
+		assert(mHeap.empty() == false);
+
+		return mHeap.front();
+	}
+
+	inline const T& value(size_t index) const
+	{
+		assert(contains(index));
+
+		return mValues[index];
+	}
+
+	//
+
+	// Capacity
+
+	inline bool empty() const
+	{
+		return mHeap.empty();
+	}
+
+	inline size_t size() const
+	{
+		return mHeap.size();
+	}
+
+	inline size_t capacity() const
+	{
+		return mPosition.size();
+	}
+
+	inline bool contains(size_t index) const
+	{
+		return mPosition[index] != npos;
+	}
+
+	//
+
+	// Modifiers
+
+	inline void push(size_t index, const T& value)
+	{
+		assert(contains(index) == false);
+
+		mValues[index] = value;
+		mPosition[index] = mHeap.size();
+		mHeap.push_back(index);
+		siftUp(mHeap.size() - 1);
+	}
+
+	// ̹ ִ ε  ٲ۴.
+	inline void update(size_t index, const T& value)
+	{
+		assert(contains(index));
+
+		mValues[index] = value;
+		siftUp(mPosition[index]);
+		siftDown(mPosition[index]);
+	}
+
+	//  ְ,    켱  ٲ۴.
+	// ٲٰų ־ true.
+	inline bool push_or_improve(size_t index, const T& value)
+	{
+		if (contains(index) == false)
+		{
+			push(index, value);
+			return true;
+		}
+
+		if (mCompare(mValues[index], value))
+		{
+			update(index, value);
+			return true;
+		}
+
+		return false;
+	}
+
+	inline void pop()
+	{
+		assert(mHeap.empty() == false);
+
+		size_t index = mHeap.front();
+		moveTo(mHeap.back(), 0);
+		mHeap.pop_back();
+		mPosition[index] = npos;
+
+		if (mHeap.empty() == false)
+		{
+			siftDown(0);
+		}
+	}
+
+	inline void clear()
+	{
+		for (size_t index : mHeap)
+		{
+			mPosition[index] = npos;
+		}
+
+		mHeap.clear();
+	}
+
+private:
+	inline void moveTo(size_t index, size_t pos)
+	{
+		mHeap[pos] = index;
+		mPosition[index] = pos;
+	}
+
+	inline void siftUp(size_t now)
+	{
+		size_t index = mHeap[now];
+
+		while (now > 0)
+		{
+			size_t parent = (now - 1) / 2;
+
+			if (mCompare(mValues[mHeap[parent]], mValues[index]) == false)
+				break;
+
+			moveTo(mHeap[parent], now);
+			now = parent;
+		}
+
+		moveTo(index, now);
+	}
+
+	inline void siftDown(size_t now)
+	{
+		size_t index = mHeap[now];
+
+		while (true)
+		{
+			size_t left = (2 * now) + 1;
+			size_t right = (2 * now) + 2;
+
+			if (left >= mHeap.size())
+				break;
+
+			size_t next = left;
+
+			if (right < mHeap.size() && mCompare(mValues[mHeap[left]], mValues[mHeap[right]]))
+				next = right;
+
+			if (mCompare(mValues[index], mValues[mHeap[next]]) == false)
+				break;
+
+			moveTo(mHeap[next], now);
+			now = next;
+		}
+
+		moveTo(index, now);
+	}
+
+private:
+	static constexpr size_t npos = static_cast<size_t>(-1);
+
+	std::vector<size_t> mHeap;      //  ġ -> ε
+	std::vector<size_t> mPosition;  // ε ->  ġ ( npos)
+	std::vector<T> mValues;         // ε -> 
+	Compare mCompare;
+};
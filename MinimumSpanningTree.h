@@ -0,0 +1,253 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include "CSRGraph.h"
+#include "DisjointSet.h"
+#include "IndexedPriorityQueue.h"
+#include "Parallel.h"
+#include "sort.h"
+
+// ּ  Ʈ
+// ġ ׷ (CSRGraph )  ϸ  ׷ Ѵ.
+//  u-v u->v, v->u  Ǿ ־ Ѵ. (AdjListGraph::to_csr )
+//   ׷ Ҹ ϳ Ʈ,  ּ   ȯѴ.
+
+// ġ   ׻   ϱ  (ġ,  , ū )  Ѵ.
+// ī Ŭ     ʿϴ.
+template<typename W>
+inline bool LighterEdge(const WeightedEdge<W>& a, const WeightedEdge<W>& b)
+{
+	if (a.weight != b.weight)
+	{
+		return a.weight < b.weight;
+	}
+
+	int aMin = std::min(a.from, a.to);
+	int bMin = std::min(b.from, b.to);
+
+	if (aMin != bMin)
+	{
+		return aMin < bMin;
+	}
+
+	return std::max(a.from, a.to) < std::max(b.from, b.to);
+}
+
+// ũ罺Į ˰
+//  ġ  (ParallelMergeSort)   Ŭ  ʴ  Union-Find 󳽴.
+// O(ElogE)
+template<typename Graph>
+std::vector<WeightedEdge<typename Graph::weight_type>> Kruskal(ThreadPool& pool, const Graph& g)
+{
+	using W = typename Graph::weight_type;
+
+	const size_t n = g.size();
+	std::vector<WeightedEdge<W>> edges;
+	edges.reserve(g.edge_count() / 2);
+
+	for (size_t u = 0; u < n; u++)
+	{
+		const W* weight = g.weight_begin(static_cast<int>(u));
+
+		for (auto it = g.begin(static_cast<int>(u)); it != g.end(static_cast<int>(u)); ++it, ++weight)
+		{
+			//   ʸ 
+			if (static_cast<int>(u) < *it)
+			{
+				edges.push_back(WeightedEdge<W>{ static_cast<int>(u), *it, *weight });
+			}
+		}
+	}
+
+	ParallelMergeSort(pool, edges.begin(), edges.end(), LighterEdge<W>);
+
+	std::vector<WeightedEdge<W>> tree;
+	tree.reserve(n > 0 ? n - 1 : 0);
+	DisjointSet set(n);
+
+	for (const auto& edge : edges)
+	{
+		if (set.Merge(edge.from, edge.to))
+		{
+			tree.push_back(edge);
+
+			if (tree.size() + 1 == n)
+			{
+				break;
+			}
+		}
+	}
+
+	return tree;
+}
+
+template<typename Graph>
+std::vector<WeightedEdge<typename Graph::weight_type>> Kruskal(const Graph& g, unsigned threadCount = 0)
+{
+	ThreadPool pool(threadCount);
+	return Kruskal(pool, g);
+}
+
+//  ˰
+// Ʈ         ε 켱 ť .
+// ť  ϳ ĺ ΰ    ã  ڸ  δ.
+// O(ElogV)
+template<typename Graph>
+std::vector<WeightedEdge<typename Graph::weight_type>> Prim(const Graph& g)
+{
+	using W = typename Graph::weight_type;
+
+	const size_t n = g.size();
+	std::vector<WeightedEdge<W>> tree;
+	tree.reserve(n > 0 ? n - 1 : 0);
+
+	std::vector<bool> inTree(n, false);
+	std::vector<int> parent(n, -1);
+	IndexedPriorityQueue<W, std::greater<W>> pq(n);
+
+	for (size_t start = 0; start < n; start++)
+	{
+		if (inTree[start])
+		{
+			continue;
+		}
+
+		pq.push(start, W());
+
+		while (pq.empty() == false)
+		{
+			int u = static_cast<int>(pq.top_index());
+			W cost = pq.top();
+			pq.pop();
+
+			inTree[u] = true;
+
+			if (parent[u] != -1)
+			{
+				tree.push_back(WeightedEdge<W>{ parent[u], u, cost });
+			}
+
+			const W* weight = g.weight_begin(u);
+			for (auto it = g.begin(u); it != g.end(u); ++it, ++weight)
+			{
+				if (inTree[*it])
+				{
+					continue;
+				}
+
+				if (pq.push_or_improve(*it, *weight))
+				{
+					parent[*it] = u;
+				}
+			}
+		}
+	}
+
+	return tree;
+}
+
+// ī ˰
+//  ܰ  Ұ ڽſԼ     ÿ  ģ.
+//   ܰ踶  Ϸ پ O(logV) ܰ迡 ,
+//     ã κ  ̶ ķ óѴ.
+// O(ElogV)
+template<typename Graph>
+std::vector<WeightedEdge<typename Graph::weight_type>> Boruvka(ThreadPool& pool, const Graph& g)
+{
+	using W = typename Graph::weight_type;
+
+	const size_t n = g.size();
+	std::vector<WeightedEdge<W>> tree;
+	tree.reserve(n > 0 ? n - 1 : 0);
+
+	DisjointSet set(n);
+	std::vector<int> component(n);
+	std::vector<WeightedEdge<W>> vertexBest(n);
+	std::vector<WeightedEdge<W>> componentBest(n);
+	std::vector<bool> hasComponentBest(n);
+
+	while (true)
+	{
+		// Find θ ϸ  ٲٹǷ     ̸ صд.
+		for (size_t v = 0; v < n; v++)
+		{
+			component[v] = set.Find(static_cast<int>(v));
+		}
+
+		// 1)  ٸ ҷ     ()
+		// ׷   from == -1
+		ParallelFor(pool, 0, n, [&](size_t first, size_t last)
+			{
+				for (size_t u = first; u < last; u++)
+				{
+					WeightedEdge<W> best{ -1, -1, W() };
+					const W* weight = g.weight_begin(static_cast<int>(u));
+
+					for (auto it = g.begin(static_cast<int>(u)); it != g.end(static_cast<int>(u)); ++it, ++weight)
+					{
+						if (component[u] == component[*it])
+						{
+							continue;
+						}
+
+						WeightedEdge<W> edge{ static_cast<int>(u), *it, *weight };
+						if (best.from == -1 || LighterEdge(edge, best))
+						{
+							best = edge;
+						}
+					}
+
+					vertexBest[u] = best;
+				}
+			});
+
+		// 2) Ҹ   
+		for (size_t v = 0; v < n; v++)
+		{
+			hasComponentBest[v] = false;
+		}
+
+		for (size_t v = 0; v < n; v++)
+		{
+			if (vertexBest[v].from == -1)
+			{
+				continue;
+			}
+
+			int c = component[v];
+			if (hasComponentBest[c] == false || LighterEdge(vertexBest[v], componentBest[c]))
+			{
+				componentBest[c] = vertexBest[v];
+				hasComponentBest[c] = true;
+			}
+		}
+
+		// 3) ġ.  Ұ     Ƿ Merge ߺ Ÿ.
+		bool merged = false;
+		for (size_t c = 0; c < n; c++)
+		{
+			if (hasComponentBest[c] && set.Merge(componentBest[c].from, componentBest[c].to))
+			{
+				tree.push_back(componentBest[c]);
+				merged = true;
+			}
+		}
+
+		if (merged == false)
+		{
+			break;
+		}
+	}
+
+	return tree;
+}
+
+template<typename Graph>
+std::vector<WeightedEdge<typename Graph::weight_type>> Boruvka(const Graph& g, unsigned threadCount = 0)
+{
+	ThreadPool pool(threadCount);
+	return Boruvka(pool, g);
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "CSRGraph.h"
+#include "MinimumSpanningTree.h"
+#include "ThreadPool.h"
+
+// ּ  Ʈ ġũ
+//  ׷  ׷ Kruskal, Prim, Boruvka ð    ġ   ȮѴ.
+//
+//	MinimumSpanningTreeBenchmarkConfig config;
+//	config.denseVertexCounts = { 1 << 11 };
+//	PrintMinimumSpanningTreeBenchmark(stdout, RunMinimumSpanningTreeBenchmark(config));
+//
+//  :   sparseDegree   մ´. (E ~ V)
+//  :    denseProbability Ȯ մ´. (E ~ V^2)
+// ġ [1, 2^20]  .   ִ´.
+
+struct MinimumSpanningTreeBenchmarkConfig
+{
+	std::vector<size_t> sparseVertexCounts = { 1 << 14, 1 << 18 };
+	size_t sparseDegree = 8;
+	std::vector<size_t> denseVertexCounts = { 1 << 10, 1 << 12 };
+	double denseProbability = 0.5;
+	unsigned repeats = 3;
+	unsigned threadCount = 0; // Kruskal , Boruvka  . 0̸ ϵ  
+	uint64_t seed = 1;
+};
+
+struct MinimumSpanningTreeBenchmarkResult
+{
+	std::string algorithm;
+	std::string input;        // "sparse" Ǵ "dense"
+	size_t vertices = 0;
+	size_t edges = 0;         //   
+	double milliseconds = 0;  // ݺ  ߾Ӱ
+	long long totalWeight = 0;
+	bool consistent = false;  //  ˰ ġ հ   
+};
+
+//  ġ ׷. dense false , true 
+inline CSRGraph<int> GenerateMinimumSpanningTreeInput(size_t n, bool dense, const MinimumSpanningTreeBenchmarkConfig& config)
+{
+	std::mt19937_64 rng(config.seed + n * 2 + (dense ? 1 : 0));
+	std::uniform_int_distribution<int> weight(1, 1 << 20);
+	std::vector<WeightedEdge<int>> edges;
+
+	auto link = [&](int u, int v)
+	{
+		const int w = weight(rng);
+		edges.push_back(WeightedEdge<int>{ u, v, w });
+		edges.push_back(WeightedEdge<int>{ v, u, w });
+	};
+
+	if (dense)
+	{
+		std::bernoulli_distribution coin(config.denseProbability);
+
+		for (size_t u = 0; u < n; u++)
+		{
+			for (size_t v = u + 1; v < n; v++)
+			{
+				if (coin(rng))
+				{
+					link(static_cast<int>(u), static_cast<int>(v));
+				}
+			}
+		}
+	}
+	else if (n > 1)
+	{
+		const size_t count = n * config.sparseDegree / 2;
+		edges.reserve(count * 2);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const int u = static_cast<int>(rng() % n);
+			const int v = static_cast<int>(rng() % n);
+
+			if (u != v)
+			{
+				link(u, v);
+			}
+		}
+	}
+
+	return CSRGraph<int>(n, edges);
+}
+
+//  ׷  ˰ .
+inline void MeasureMinimumSpanningTree(ThreadPool& pool, const CSRGraph<int>& g, const char* input, unsigned repeats,
+	std::vector<MinimumSpanningTreeBenchmarkResult>& results)
+{
+	auto totalWeight = [](const std::vector<WeightedEdge<int>>& tree)
+	{
+		long long sum = 0;
+		for (const auto& edge : tree)
+		{
+			sum += edge.weight;
+		}
+
+		return sum;
+	};
+
+	auto measure = [&](const char* name, auto build)
+	{
+		std::vector<double> times;
+		std::vector<WeightedEdge<int>> tree;
+
+		for (unsigned r = 0; r < std::max(repeats, 1u); r++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			tree = build();
+			times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+		}
+
+		std::sort(times.begin(), times.end());
+
+		MinimumSpanningTreeBenchmarkResult result;
+		result.algorithm = name;
+		result.input = input;
+		result.vertices = g.size();
+		result.edges = g.edge_count() / 2;
+		result.milliseconds = times[times.size() / 2];
+		result.totalWeight = totalWeight(tree);
+		results.push_back(result);
+
+		return tree.size();
+	};
+
+	const size_t first = results.size();
+	const size_t kruskal = measure("Kruskal", [&]() { return Kruskal(pool, g); });
+	const size_t prim = measure("Prim", [&]() { return Prim(g); });
+	const size_t boruvka = measure("Boruvka", [&]() { return Boruvka(pool, g); });
+
+	const bool consistent = kruskal == prim && prim == boruvka &&
+		results[first].totalWeight == results[first + 1].totalWeight &&
+		results[first + 1].totalWeight == results[first + 2].totalWeight;
+
+	for (size_t i = first; i < results.size(); i++)
+	{
+		results[i].consistent = consistent;
+	}
+}
+
+inline std::vector<MinimumSpanningTreeBenchmarkResult> RunMinimumSpanningTreeBenchmark(
+	const MinimumSpanningTreeBenchmarkConfig& config = MinimumSpanningTreeBenchmarkConfig())
+{
+	ThreadPool pool(config.threadCount);
+	std::vector<MinimumSpanningTreeBenchmarkResult> results;
+
+	for (size_t n : config.sparseVertexCounts)
+	{
+		MeasureMinimumSpanningTree(pool, GenerateMinimumSpanningTreeInput(n, false, config), "sparse", config.repeats, results);
+	}
+
+	for (size_t n : config.denseVertexCounts)
+	{
+		MeasureMinimumSpanningTree(pool, GenerateMinimumSpanningTreeInput(n, true, config), "dense", config.repeats, results);
+	}
+
+	return results;
+}
+
+//   ǥ
+inline void PrintMinimumSpanningTreeBenchmark(FILE* file, const std::vector<MinimumSpanningTreeBenchmarkResult>& results)
+{
+	fprintf(file, "%-9s %-7s %10s %12s %10s %16s %s\n", "algorithm", "input", "vertices", "edges", "ms", "weight", "ok");
+
+	for (const MinimumSpanningTreeBenchmarkResult& r : results)
+	{
+		fprintf(file, "%-9s %-7s %10zu %12zu %10.2f %16lld %s\n",
+			r.algorithm.c_str(), r.input.c_str(), r.vertices, r.edges, r.milliseconds, r.totalWeight,
+			r.consistent ? "ok" : "FAIL");
+	}
+}
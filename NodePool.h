@@ -0,0 +1,215 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+//  Ǯ (Slab Allocator)
+// Ʈ ó  ũ ü ϳ     .
+// - 带  (ū )  ޾ տ ߶ . malloc 帶 θ ʰ, ʷ  尡 ޸𸮿 δ.
+// -     (freelist) ־  Ҵ翡  .    ּҴ   ڸ ´.
+// - release  ش. O( )
+// - merge ٸ Ǯ    Ѱܹ޴´.  Ʈ ĥ  带 ű ʾƵ ȴ.
+// allocate ʱȭ  T  ĭ ش.  Ҹ (placement new, Ҹ ȣ)   Ѵ.
+//  ũ NodePoolMinSlabNodes   辿 ÷ NodePoolMaxSlabBytes .
+constexpr size_t NodePoolMinSlabNodes = 32;
+constexpr size_t NodePoolMaxSlabBytes = 1 << 20;
+
+template<typename T, typename Allocator = std::allocator<T>>
+class NodePool
+{
+private:
+	//  ߿ T,     ĭ
+	union Slot
+	{
+		Slot* next;
+		alignas(T) unsigned char storage[sizeof(T)];
+	};
+
+	using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+	using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+public:
+	// constructor
+
+	explicit NodePool(const Allocator& alloc = Allocator())
+		: mAllocator(alloc)
+	{}
+
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+
+	NodePool(NodePool&& other) noexcept
+		: mAllocator(other.mAllocator)
+	{
+		swap(other);
+	}
+
+	NodePool& operator=(NodePool&& other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
+	//
+
+	// destructor
+
+	~NodePool()
+	{
+		release();
+	}
+
+	//
+
+	T* allocate()
+	{
+		Slot* slot = mFree;
+
+		if (slot != nullptr)
+		{
+			mFree = slot->next;
+		}
+		else
+		{
+			if (mCursor == mEnd)
+			{
+				addSlab(mNextSlabSlots);
+			}
+
+			slot = mCursor++;
+		}
+
+		return reinterpret_cast<T*>(slot->storage);
+	}
+
+	//  count allocate Ҵڸ θ ʵ  ̸ ޾ д.
+	//    ʰ,    ĭ ڶ  ĭ    ޴´.
+	void reserve(size_t count)
+	{
+		if (static_cast<size_t>(mEnd - mCursor) < count)
+		{
+			addSlab(std::max(count, mNextSlabSlots));
+		}
+	}
+
+	// Ҹڴ θ ʴ´.
+	void deallocate(T* node) noexcept
+	{
+		assert(node != nullptr);
+
+		Slot* slot = reinterpret_cast<Slot*>(node);
+
+		if (mFree == nullptr)
+		{
+			mFreeTail = slot;
+		}
+
+		slot->next = mFree;
+		mFree = slot;
+	}
+
+	//  带 Ѳ ش. ִ  Ҹڴ θ ʴ´.
+	void release() noexcept
+	{
+		for (const auto& slab : mSlabs)
+		{
+			SlotTraits::deallocate(mAllocator, slab.first, slab.second);
+		}
+
+		mSlabs.clear();
+		mFree = nullptr;
+		mFreeTail = nullptr;
+		mCursor = nullptr;
+		mEnd = nullptr;
+		mNextSlabSlots = NodePoolMinSlabNodes;
+	}
+
+	void swap(NodePool& other) noexcept
+	{
+		std::swap(mAllocator, other.mAllocator);
+		std::swap(mSlabs, other.mSlabs);
+		std::swap(mFree, other.mFree);
+		std::swap(mFreeTail, other.mFreeTail);
+		std::swap(mCursor, other.mCursor);
+		std::swap(mEnd, other.mEnd);
+		std::swap(mNextSlabSlots, other.mNextSlabSlots);
+	}
+
+	// other   Ѱܹ޴´. other     Ǯ ش. O(other  )
+	//  Ǯ Ҵڰ ƾ Ѵ.    ĭ   ʸ ̾   release   ʴ´.
+	void merge(NodePool& other)
+	{
+		assert(this != &other);
+		assert(mAllocator == other.mAllocator);
+
+		mSlabs.insert(mSlabs.end(), other.mSlabs.begin(), other.mSlabs.end());
+
+		if (other.mFree != nullptr)
+		{
+			if (mFree == nullptr)
+			{
+				mFreeTail = other.mFreeTail;
+			}
+
+			other.mFreeTail->next = mFree;
+			mFree = other.mFree;
+		}
+
+		if (other.mEnd - other.mCursor > mEnd - mCursor)
+		{
+			mCursor = other.mCursor;
+			mEnd = other.mEnd;
+		}
+
+		mNextSlabSlots = std::max(mNextSlabSlots, other.mNextSlabSlots);
+
+		other.mSlabs.clear();
+		other.mFree = nullptr;
+		other.mFreeTail = nullptr;
+		other.mCursor = nullptr;
+		other.mEnd = nullptr;
+		other.mNextSlabSlots = NodePoolMinSlabNodes;
+	}
+
+	inline size_t slab_count() const noexcept
+	{
+		return mSlabs.size();
+	}
+
+	inline Allocator get_allocator() const
+	{
+		return Allocator(mAllocator);
+	}
+
+private:
+	void addSlab(size_t slots)
+	{
+		// push_back     ʵ ڸ  ´.
+		if (mSlabs.size() == mSlabs.capacity())
+		{
+			mSlabs.reserve(mSlabs.size() * 2 + 8);
+		}
+
+		Slot* slab = SlotTraits::allocate(mAllocator, slots);
+		mSlabs.push_back({ slab, slots });
+
+		mCursor = slab;
+		mEnd = slab + slots;
+
+		const size_t maxSlots = std::max<size_t>(NodePoolMinSlabNodes, NodePoolMaxSlabBytes / sizeof(Slot));
+		mNextSlabSlots = std::min(slots * 2, maxSlots);
+	}
+
+private:
+	SlotAllocator mAllocator;
+	std::vector<std::pair<Slot*, size_t>> mSlabs; // (, ĭ )
+	Slot* mFree = nullptr;     //   Ӹ
+	Slot* mFreeTail = nullptr; //    (mFree nullptr̸ ǹ )
+	Slot* mCursor = nullptr;   //      ù ĭ
+	Slot* mEnd = nullptr;
+	size_t mNextSlabSlots = NodePoolMinSlabNodes;
+};
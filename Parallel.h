@@ -0,0 +1,42 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include "ThreadPool.h"
+
+// [begin, end)  pool  ŭ     Ѵ.
+// func(first, last)  ۾   ޴´.
+//    尡  óϰ,   ۾  ʴ´.
+template<typename Func>
+void ParallelFor(ThreadPool& pool, size_t begin, size_t end, Func&& func)
+{
+	if (begin >= end)
+	{
+		return;
+	}
+
+	const size_t count = end - begin;
+	const size_t chunks = std::min<size_t>(pool.size(), count);
+
+	if (chunks <= 1)
+	{
+		func(begin, end);
+		return;
+	}
+
+	const size_t chunk = count / chunks;
+	const size_t remain = count % chunks;
+
+	TaskGroup group(pool);
+	size_t first = begin;
+
+	for (size_t t = 0; t + 1 < chunks; t++)
+	{
+		const size_t last = first + chunk + (t < remain ? 1 : 0);
+		group.run([&func, first, last]() { func(first, last); });
+		first = last;
+	}
+
+	func(first, end);
+	group.wait();
+}
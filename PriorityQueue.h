@@ -1,7 +1,132 @@
 #pragma once
 
+#include <cassert>
+#include <functional>
+#include <utility>
 #include <vector>
 
+// 迭 first[0 .. length)   Ʈ   
+// i  ڽ 2i+1, 2i+2, θ (i-1)/2
+// comp(a, b) true b   ´. (std::less ->  ū  first[0])
+// PriorityQueue HeapSort Բ .
+
+// pos  θ𺸴 Ʒ   ø.
+// ȯ  ڸ (hole) ű     .
+template<typename RandomIt, typename Compare>
+void HeapSiftUp(RandomIt first, size_t pos, Compare comp)
+{
+	auto value = std::move(first[pos]);
+
+	while (pos > 0)
+	{
+		size_t parent = (pos - 1) / 2;
+
+		if (comp(first[parent], value) == false)
+			break;
+
+		first[pos] = std::move(first[parent]);
+		pos = parent;
+	}
+
+	first[pos] = std::move(value);
+}
+
+// pos   ڽĺ   Ʒ .
+template<typename RandomIt, typename Compare>
+void HeapSiftDown(RandomIt first, size_t pos, size_t length, Compare comp)
+{
+	auto value = std::move(first[pos]);
+
+	while (true)
+	{
+		size_t left = (2 * pos) + 1;
+		size_t right = (2 * pos) + 2;
+
+		if (left >= length)
+			break;
+
+		size_t next = left;
+
+		if (right < length && comp(first[left], first[right]))
+			next = right;
+
+		if (comp(value, first[next]) == false)
+			break;
+
+		first[pos] = std::move(first[next]);
+		pos = next;
+	}
+
+	first[pos] = std::move(value);
+}
+
+// Ʒ  (bottom-up) 
+//     ű  (pop)   밳 ٽ ٴ ó .
+// ׷   ʰ  ū ڽĸ  ڸ ٱ  ,  ڸ   ø.
+// ܰ踶 񱳰 2 1 پ ü     ȴ.
+template<typename RandomIt, typename Compare>
+void HeapSiftDownBottomUp(RandomIt first, size_t pos, size_t length, Compare comp)
+{
+	const size_t top = pos;
+	auto value = std::move(first[pos]);
+
+	while (true)
+	{
+		size_t left = (2 * pos) + 1;
+		size_t right = (2 * pos) + 2;
+
+		if (left >= length)
+			break;
+
+		size_t next = left;
+
+		if (right < length && comp(first[left], first[right]))
+			next = right;
+
+		first[pos] = std::move(first[next]);
+		pos = next;
+	}
+
+	while (pos > top)
+	{
+		size_t parent = (pos - 1) / 2;
+
+		if (comp(first[parent], value) == false)
+			break;
+
+		first[pos] = std::move(first[parent]);
+		pos = parent;
+	}
+
+	first[pos] = std::move(value);
+}
+
+// ÷̵   (Floyd's build-heap)
+//  θ Ųٷ  . κ 尡 ٴ ó O(N)
+template<typename RandomIt, typename Compare>
+void MakeHeap(RandomIt first, RandomIt last, Compare comp)
+{
+	const size_t length = static_cast<size_t>(last - first);
+
+	for (size_t pos = length / 2; pos > 0; pos--)
+	{
+		HeapSiftDown(first, pos - 1, length, comp);
+	}
+}
+
+//   last - 1 ű [first, last - 1) ٽ  .
+template<typename RandomIt, typename Compare>
+void PopHeap(RandomIt first, RandomIt last, Compare comp)
+{
+	const size_t length = static_cast<size_t>(last - first);
+
+	if (length <= 1)
+		return;
+
+	std::swap(first[0], first[length - 1]);
+	HeapSiftDownBottomUp(first, 0, length - 1, comp);
+}
+
 template<typename T, typename Container = std::vector<T>, typename Compare = std::less<T>>
 class PriorityQueue
 {
@@ -89,73 +214,33 @@ public:
 	{
 		mContainer.push_back(value);
 
-		size_t now = mContainer.size() - 1;
-
-		while (now > 0)
-		{
-			size_t parent = (now - 1) / 2;
-
-			if (mCompare(mContainer[now], mContainer[parent]))
-				break;
-
-			std::swap(mContainer[now], mContainer[parent]);
-			now = parent;
-		}
+		HeapSiftUp(mContainer.begin(), mContainer.size() - 1, mCompare);
 	}
 
 	inline void push(T&& value)
 	{
 		mContainer.push_back(std::move(value));
 
-		size_t now = mContainer.size() - 1;
-
-		while (now > 0)
-		{
-			size_t parent = (now - 1) / 2;
-
-			if (mCompare(mContainer[now], mContainer[parent]))
-				break;
-
-			std::swap(mContainer[now], mContainer[parent]);
-			now = parent;
-		}
+		HeapSiftUp(mContainer.begin(), mContainer.size() - 1, mCompare);
 	}
 
 	inline void pop()
 	{
-		mContainer[0] = mContainer.back();
-		mContainer.pop_back();
+		assert(mContainer.empty() == false);
 
-		size_t now = 0;
+		mContainer[0] = std::move(mContainer.back());
+		mContainer.pop_back();
 
-		while (true)
+		if (mContainer.empty() == false)
 		{
-			size_t left = (2 * now) + 1;
-			size_t right = (2 * now) + 2;
-
-			if (left >= mContainer.size())
-				break;
-
-			size_t next = now;
-
-			if (mCompare(mContainer[next], mContainer[left]))
-				next = left;
-
-			if (right < mContainer.size() && mCompare(mContainer[next], mContainer[left]))
-				next = right;
-
-			if (now == next)
-				break;
-
-			std::swap(mContainer[now], mContainer[next]);
-			now = next;
+			HeapSiftDownBottomUp(mContainer.begin(), 0, mContainer.size(), mCompare);
 		}
 	}
 
 	inline void swap(PriorityQueue& other) noexcept
 	{
 		mContainer.swap(other.mContainer);
-		mCompare.swap(other.mCompare);
+		std::swap(mCompare, other.mCompare);
 	}
 
 private:
@@ -1,19 +1,32 @@
 #pragma once
 
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "NodePool.h"
+#include "ThreadPool.h"
+
 enum class eColor
 {
 	Red = 0,
 	Black = 1,
 };
 
-struct Node
-{
-	Node* parent = nullptr;
-	Node* left = nullptr;
-	Node* right = nullptr;
-	int key = {};
-	eColor color = eColor::Black;
-};
+//  꿡  Ʈ    ̺    ʰ  忡 óѴ.
+constexpr size_t RedBlackTreeParallelGrain = 1 << 14;
+
+// ֿܼ Ʈ ׸ (RedBlackTree.cpp, Windows ܼ )
+void RedBlackTreeClearConsole();
+void RedBlackTreePrintNode(const std::string& text, eColor color, int x, int y);
 
 // Red-Black Tree
 // 1)   Red or Black
@@ -21,36 +34,1997 @@ struct Node
 // 3) Leaf(NIL) Black
 // 4) Red  ڽ Black (ؼ Red-Red X)
 // 5)  κ -   ε    Black
+//
+// Ű ߺ ʴ ĵ  (std::map  ̽)
+// Ҵ std::pair<const Key, Value>̰ Compare  ȸѴ.
+// ,  ٸ  ݺڸ ȿȭ ʴ´.
+//
+// 帶 Ʈ   Բ  ξ (order statistic tree)
+//  (rank), k°  (select),    (count_range) O(logN) Ѵ.
+//   ,  ο ȸ ģ.
+template<typename Key, typename Value, typename Compare = std::less<Key>,
+	typename Allocator = std::allocator<std::pair<const Key, Value>>>
 class RedBlackTree
 {
 public:
-	RedBlackTree();
-	~RedBlackTree();
+	using key_type = Key;
+	using mapped_type = Value;
+	using value_type = std::pair<const Key, Value>;
+	using key_compare = Compare;
+	using allocator_type = Allocator;
+	using size_type = size_t;
+
+private:
+	// NIL   Ƿ ũ, ,   (0) .
+	//    ũ ĵǾ parent ּ   Ʈ ׻ 0̴.
+	//  Ʈ  ־ (1̸ Red)  ʵ е 8Ʈ ش. ( 3 +   = 32Ʈ)
+	struct NodeBase
+	{
+		NodeBase* left = nullptr;
+		NodeBase* right = nullptr;
+		size_t size = 0; //  带 Ʈ ϴ Ʈ  
+
+		inline NodeBase* parent() const
+		{
+			return reinterpret_cast<NodeBase*>(mParentColor & ~RedBit);
+		}
+
+		inline void set_parent(NodeBase* parent)
+		{
+			mParentColor = reinterpret_cast<uintptr_t>(parent) | (mParentColor & RedBit);
+		}
+
+		inline eColor color() const
+		{
+			return (mParentColor & RedBit) ? eColor::Red : eColor::Black;
+		}
+
+		inline void set_color(eColor color)
+		{
+			mParentColor = (mParentColor & ~RedBit) | (color == eColor::Red ? RedBit : 0);
+		}
+
+	private:
+		static constexpr uintptr_t RedBit = 1;
+
+		uintptr_t mParentColor = 0; // parent ּ |  (⺻ nullptr, Black)
+	};
+
+	static_assert(alignof(NodeBase) >= 2, "low bit of the parent pointer must be free");
+
+	struct Node : NodeBase
+	{
+		template<typename... Args>
+		Node(Args&&... args)
+			: value(std::forward<Args>(args)...)
+		{}
+
+		value_type value;
+	};
+
+	using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+	//   ߿   ٷ Ʈ. Ʈ Black̰ parent NIL̴.
+	struct Subtree
+	{
+		NodeBase* root = nullptr;
+		size_t blackHeight = 0; // Ʈ NIL Black   (NIL  ʴ´)
+	};
+
+	struct SplitResult
+	{
+		Subtree left;
+		NodeBase* found; // key   (ڽ ),  NIL
+		Subtree right;
+	};
+
+	//  꿡  Ʈ . Ʈ Ʈ parent  ׸ մ´.
+	// 帶  Ҵٰ ̾ ̰,    忡 Ǯ ش.
+	struct Garbage
+	{
+		NodeBase* head = nullptr;
+		NodeBase* tail = nullptr;
+
+		void push(NodeBase* root)
+		{
+			root->set_parent(nullptr);
+			append({ root, root });
+		}
+
+		void append(const Garbage& other)
+		{
+			if (other.head == nullptr)
+			{
+				return;
+			}
+
+			if (tail != nullptr)
+			{
+				tail->set_parent(other.head);
+			}
+			else
+			{
+				head = other.head;
+			}
+
+			tail = other.tail;
+		}
+	};
+
+	template<bool IsConst>
+	class Iterator
+	{
+	public:
+		friend class RedBlackTree;
+		template<bool> friend class Iterator;
+
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = std::pair<const Key, Value>;
+		using difference_type = ptrdiff_t;
+		using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+		using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+	public:
+		Iterator()
+			: mTree(nullptr)
+			, mNode(nullptr)
+		{}
+
+		Iterator(const RedBlackTree* tree, NodeBase* node)
+			: mTree(tree)
+			, mNode(node)
+		{}
+
+		// iterator -> const_iterator
+		template<bool OtherConst, typename = std::enable_if_t<IsConst && OtherConst == false>>
+		Iterator(const Iterator<OtherConst>& other)
+			: mTree(other.mTree)
+			, mNode(other.mNode)
+		{}
+
+		Iterator& operator++()
+		{
+			mNode = mTree->Next(mNode);
+			return *this;
+		}
+
+		Iterator operator++(int)
+		{
+			Iterator temp = *this;
+			mNode = mTree->Next(mNode);
+			return temp;
+		}
+
+		// end()   
+		Iterator& operator--()
+		{
+			mNode = mTree->Prev(mNode);
+			return *this;
+		}
+
+		Iterator operator--(int)
+		{
+			Iterator temp = *this;
+			mNode = mTree->Prev(mNode);
+			return temp;
+		}
+
+		reference operator*() const
+		{
+			return static_cast<Node*>(mNode)->value;
+		}
+
+		pointer operator->() const
+		{
+			return &static_cast<Node*>(mNode)->value;
+		}
+
+		bool operator==(const Iterator& other) const noexcept
+		{
+			return mNode == other.mNode;
+		}
+
+		bool operator!=(const Iterator& other) const noexcept
+		{
+			return mNode != other.mNode;
+		}
+
+	private:
+		const RedBlackTree* mTree;
+		NodeBase* mNode;
+	};
+
+public:
+	using iterator = Iterator<false>;
+	using const_iterator = Iterator<true>;
+
+	// [first, last) ݺ .   for ٷ .
+	template<typename It>
+	class Range
+	{
+	public:
+		Range(It first, It last)
+			: mFirst(first)
+			, mLast(last)
+		{}
+
+		inline It begin() const { return mFirst; }
+		inline It end() const { return mLast; }
+		inline bool empty() const { return mFirst == mLast; }
+
+	private:
+		It mFirst;
+		It mLast;
+	};
+
+	// constructor
+
+	RedBlackTree()
+		: RedBlackTree(Compare())
+	{}
+
+	explicit RedBlackTree(const Compare& comp, const Allocator& alloc = Allocator())
+		: mCompare(comp)
+		, mPool(NodeAllocator(alloc))
+	{
+		// NIL  ٴ · .
+		//   ͺٴ ϳ   Ű Ѵ.
+		mNil = new NodeBase(); // Black
+		mRoot = mNil;
+	}
+
+	RedBlackTree(std::initializer_list<value_type> init, const Compare& comp = Compare(), const Allocator& alloc = Allocator())
+		: RedBlackTree(comp, alloc)
+	{
+		for (const value_type& value : init)
+		{
+			insert(value);
+		}
+	}
+
+	RedBlackTree(const RedBlackTree& other)
+		: RedBlackTree(other.mCompare, std::allocator_traits<NodeAllocator>::select_on_container_copy_construction(other.mPool.get_allocator()))
+	{
+		mRoot = copyTree(other.mRoot, other.mNil, mNil);
+		mSize = other.mSize;
+	}
+
+	// Ű ʵ  Ʈ   ֵ NIL   ٲ۴.
+	RedBlackTree(RedBlackTree&& other)
+		: RedBlackTree(other.mCompare, other.mPool.get_allocator())
+	{
+		swap(other);
+	}
+
+	//
+
+	// destructor
+
+	~RedBlackTree()
+	{
+		clear();
+		delete mNil;
+	}
+
+	//
+
+	// operator =
+
+	RedBlackTree& operator=(const RedBlackTree& other)
+	{
+		if (this != &other)
+		{
+			RedBlackTree temp(other);
+			swap(temp);
+		}
+
+		return *this;
+	}
+
+	RedBlackTree& operator=(RedBlackTree&& other) noexcept
+	{
+		swap(other);
+
+		return *this;
+	}
+
+	//
+
+	// Element access
+
+	Value& at(const Key& key)
+	{
+		iterator it = find(key);
+		if (it == end())
+		{
+			throw std::out_of_range("invalid RedBlackTree key");
+		}
+
+		return it->second;
+	}
+
+	const Value& at(const Key& key) const
+	{
+		const_iterator it = find(key);
+		if (it == end())
+		{
+			throw std::out_of_range("invalid RedBlackTree key");
+		}
+
+		return it->second;
+	}
+
+	//  Value() ִ´.
+	Value& operator[](const Key& key)
+	{
+		return try_emplace(key).first->second;
+	}
+
+	Value& operator[](Key&& key)
+	{
+		return try_emplace(std::move(key)).first->second;
+	}
+
+	//
+
+	// Iterators
+
+	inline iterator begin() noexcept
+	{
+		return iterator(this, Min(mRoot));
+	}
+
+	inline const_iterator begin() const noexcept
+	{
+		return const_iterator(this, Min(mRoot));
+	}
+
+	inline iterator end() noexcept
+	{
+		return iterator(this, mNil);
+	}
+
+	inline const_iterator end() const noexcept
+	{
+		return const_iterator(this, mNil);
+	}
+
+	//
+
+	// Capacity
+
+	inline bool empty() const noexcept
+	{
+		return mSize == 0;
+	}
+
+	inline size_t size() const noexcept
+	{
+		return mSize;
+	}
+
+	//
+
+	// Modifiers
+
+	//  Ҹڸ θ (ʿ  ̸ ǳʶڴ)  ޸𸮴 Ǯ° ش.
+	void clear() noexcept
+	{
+		if constexpr (std::is_trivially_destructible_v<value_type> == false)
+		{
+			destroyValues(mRoot);
+		}
+
+		mPool.release();
+		mRoot = mNil;
+		mSize = 0;
+	}
+
+	// ĵǾ ְ Ű ߺ ʴ   Ʈ  . O(N)
+	//  Ҹ Ʈ    NIL ̰   (d, d + 1)̴.
+	//  d = floor(log2(N + 1)) ִ  ( Ʒ ä  ܰ) Red ĥϸ
+	//   Black  . ȸ̳ InsertFixup .
+	template<typename ForwardIt>
+	void build_from_sorted(ForwardIt first, ForwardIt last)
+	{
+		clear();
+
+		const size_t n = static_cast<size_t>(std::distance(first, last));
+
+		size_t redDepth = 0;
+		while (((n + 1) >> (redDepth + 1)) != 0)
+		{
+			redDepth++;
+		}
+
+		NodeBase* prev = mNil;
+		mRoot = buildSubtree(first, n, 0, redDepth, prev);
+		mRoot->set_parent(mNil);
+		mSize = n;
+	}
+
+	template<typename Container>
+	auto build_from_sorted(const Container& values) -> decltype(std::begin(values), void())
+	{
+		build_from_sorted(std::begin(values), std::end(values));
+	}
+
+	// ̹ ִ Ű  ʰ  Ҹ ش.
+	std::pair<iterator, bool> insert(const value_type& value)
+	{
+		return try_emplace(value.first, value.second);
+	}
+
+	std::pair<iterator, bool> insert(value_type&& value)
+	{
+		// value.first const ű  .
+		return try_emplace(value.first, std::move(value.second));
+	}
+
+	// 带   Ű Ѵ. ̹ ִ Ű  带 .
+	template<typename... Args>
+	std::pair<iterator, bool> emplace(Args&&... args)
+	{
+		Node* node = createNode(std::forward<Args>(args)...);
+
+		NodeBase* parent = nullptr;
+		NodeBase* found = findInsertPosition(node->value.first, parent);
+
+		if (found != mNil)
+		{
+			destroyNode(node);
+			return { iterator(this, found), false };
+		}
 
-	void Print();
-	void Print(Node* node, int x, int y);
+		return { iterator(this, insertNode(node, parent)), true };
+	}
 
-	Node* Search(Node* node, int key);
+	// Ű   带 .
+	template<typename K, typename... Args>
+	std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+	{
+		NodeBase* parent = nullptr;
+		NodeBase* found = findInsertPosition(key, parent);
 
-	Node* Min(Node* node);
-	Node* Max(Node* node);
-	Node* Next(Node* node);
+		if (found != mNil)
+		{
+			return { iterator(this, found), false };
+		}
 
-	void Insert(int key);
-	void InsertFixup(Node* node);
+		Node* node = createNode(std::piecewise_construct,
+			std::forward_as_tuple(std::forward<K>(key)),
+			std::forward_as_tuple(std::forward<Args>(args)...));
 
-	void Delete(int key);
-	void Delete(Node* node);
-	void DeleteFixup(Node* node);
+		return { iterator(this, insertNode(node, parent)), true };
+	}
 
-	void Replace(Node* u, Node* v);
+	//    Ҹ ش.
+	iterator erase(const_iterator pos)
+	{
+		assert(pos.mNode != mNil);
 
-	// Red-Black Tree
-	void LeftRotate(Node* node);
-	void RightRotate(Node* node);
+		NodeBase* next = Next(pos.mNode);
+		Delete(pos.mNode);
+
+		return iterator(this, next);
+	}
+
+	size_t erase(const Key& key)
+	{
+		NodeBase* node = Search(key);
+		if (node == mNil)
+		{
+			return 0;
+		}
+
+		Delete(node);
+		return 1;
+	}
+
+	void swap(RedBlackTree& other) noexcept
+	{
+		std::swap(mCompare, other.mCompare);
+		mPool.swap(other.mPool);
+		std::swap(mRoot, other.mRoot);
+		std::swap(mNil, other.mNil);
+		std::swap(mSize, other.mSize);
+	}
+
+	//
+
+	// Lookup
+
+	inline iterator find(const Key& key)
+	{
+		return iterator(this, Search(key));
+	}
+
+	inline const_iterator find(const Key& key) const
+	{
+		return const_iterator(this, Search(key));
+	}
+
+	inline size_t count(const Key& key) const
+	{
+		return Search(key) != mNil ? 1 : 0;
+	}
+
+	inline bool contains(const Key& key) const
+	{
+		return Search(key) != mNil;
+	}
+
+	// key ̻ ù 
+	inline iterator lower_bound(const Key& key)
+	{
+		return iterator(this, LowerBound(key));
+	}
+
+	inline const_iterator lower_bound(const Key& key) const
+	{
+		return const_iterator(this, LowerBound(key));
+	}
+
+	// key ū ù 
+	inline iterator upper_bound(const Key& key)
+	{
+		return iterator(this, UpperBound(key));
+	}
+
+	inline const_iterator upper_bound(const Key& key) const
+	{
+		return const_iterator(this, UpperBound(key));
+	}
+
+	inline std::pair<iterator, iterator> equal_range(const Key& key)
+	{
+		return { lower_bound(key), upper_bound(key) };
+	}
+
+	inline std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+	{
+		return { lower_bound(key), upper_bound(key) };
+	}
+
+	//
+
+	// Order statistics
+
+	// key    (= lower_bound(key) ġ)
+	size_t rank(const Key& key) const
+	{
+		NodeBase* node = mRoot;
+		size_t result = 0;
+
+		while (node != mNil)
+		{
+			if (mCompare(KeyOf(node), key))
+			{
+				result += node->left->size + 1;
+				node = node->right;
+			}
+			else
+			{
+				node = node->left;
+			}
+		}
+
+		return result;
+	}
+
+	// ݺڰ Ű   (0). end() size()
+	size_t index_of(const_iterator pos) const
+	{
+		NodeBase* node = pos.mNode;
+		if (node == mNil)
+		{
+			return mSize;
+		}
+
+		size_t result = node->left->size;
+
+		for (NodeBase* parent = node->parent(); parent != mNil; node = parent, parent = parent->parent())
+		{
+			if (node == parent->right)
+			{
+				result += parent->left->size + 1;
+			}
+		}
+
+		return result;
+	}
+
+	// k° (0) . k >= size() end()
+	inline iterator select(size_t k)
+	{
+		return iterator(this, Select(k));
+	}
+
+	inline const_iterator select(size_t k) const
+	{
+		return const_iterator(this, Select(k));
+	}
+
+	// [lo, hi)   
+	size_t count_range(const Key& lo, const Key& hi) const
+	{
+		if (mCompare(lo, hi) == false)
+		{
+			return 0;
+		}
+
+		return rank(hi) - rank(lo);
+	}
+
+	// [lo, hi)  Ҹ ȸѴ.
+	Range<iterator> range(const Key& lo, const Key& hi)
+	{
+		if (mCompare(lo, hi) == false)
+		{
+			return { end(), end() };
+		}
+
+		return { lower_bound(lo), lower_bound(hi) };
+	}
+
+	Range<const_iterator> range(const Key& lo, const Key& hi) const
+	{
+		if (mCompare(lo, hi) == false)
+		{
+			return { end(), end() };
+		}
+
+		return { lower_bound(lo), lower_bound(hi) };
+	}
+
+	//
+
+	// Set operations
+	// join, split   Ʈ  ģ. (Blelloch, Ferizovic, Sun. Just Join for Parallel Ordered Sets)
+	// - join(L, k, R): L  Ű < k < R  Ű    ̸ŭ   Ʈ մ´. O(|bh(L) - bh(R)|)
+	// - split(T, k): k  , ū , k  . O(logN)
+	// - , ,   Ʈ Ʈ Ű ٸ Ʈ splitϰ  ͷ ó  joinѴ.
+	//    ʹ  ٸ 常 ǵ帮Ƿ ThreadPool    ִ. ũⰡ m <= n  O(m log(n / m + 1))
+	//
+	//   Ʈ  other  Ʈ ȴ.   ʰ other Ǯ ° Ѱܹ޴´.
+	// ( Ʈ Ҵڰ ƾ Ѵ.) ʿ ִ Ű  Ʈ Ҹ .
+	//   Ʈ 尡 Ű NIL ū  NIL ٲٴ  O(min(n, m)) .
+
+	// right  Ű  Ʈ  Ű Ŀ Ѵ. O(logN + min(n, m))
+	void join(RedBlackTree& right)
+	{
+		if (this == &right || right.empty())
+		{
+			return;
+		}
+
+		assert(empty() || mCompare(KeyOf(Max(mRoot)), KeyOf(right.Min(right.mRoot))));
+
+		NodeBase* rightRoot = adopt(right, nullptr);
+		Subtree result = Concat({ mRoot, BlackHeight(mRoot) }, { rightRoot, BlackHeight(rightRoot) });
+		setRoot(result.root);
+	}
+
+	// key ̻ Ҹ  ش.  Ʈ key  Ұ ´. O(logN + min(n, m))
+	//   Ǯ Ƿ   Ҹ  Ǯ ű ū  Ǯ ״ .
+	RedBlackTree split(const Key& key)
+	{
+		RedBlackTree greater(mCompare, get_allocator());
+
+		SplitResult parts = Split({ mRoot, BlackHeight(mRoot) }, key);
+		Subtree left = parts.left;
+		Subtree right = parts.right;
+
+		if (parts.found != mNil)
+		{
+			right = Join({ mNil, 0 }, parts.found, right);
+		}
+
+		mRoot = mNil;
+		mSize = 0;
+
+		// Ǯ ̸ ä ιǷ ű ߿ Ҵ  ʴ´.  ű ܰ   ִ  ϹǷ
+		// ϸ   ٽ ̾  .
+		try
+		{
+			if (right.root->size <= left.root->size)
+			{
+				greater.mPool.reserve(right.root->size);
+				greater.mRoot = greater.template copyTree<true>(right.root, mNil, greater.mNil);
+				greater.mSize = right.root->size;
+				destroyTree(right.root);
+				setRoot(left.root);
+			}
+			else
+			{
+				mPool.swap(greater.mPool);
+				std::swap(mNil, greater.mNil);
+				greater.setRoot(right.root);
+
+				try
+				{
+					mPool.reserve(left.root->size);
+					mRoot = copyTree<true>(left.root, greater.mNil, mNil);
+				}
+				catch (...)
+				{
+					mPool.swap(greater.mPool);
+					std::swap(mNil, greater.mNil);
+					greater.mRoot = greater.mNil;
+					greater.mSize = 0;
+					throw;
+				}
+
+				mSize = left.root->size;
+				greater.destroyTree(left.root);
+			}
+		}
+		catch (...)
+		{
+			setRoot(Concat(left, right).root);
+			throw;
+		}
+
+		return greater;
+	}
+
+	// 
+	void set_union(RedBlackTree& other)
+	{
+		setOperation(nullptr, other, &RedBlackTree::Union);
+	}
+
+	void set_union(ThreadPool& pool, RedBlackTree& other)
+	{
+		setOperation(&pool, other, &RedBlackTree::Union);
+	}
+
+	// 
+	void set_intersection(RedBlackTree& other)
+	{
+		setOperation(nullptr, other, &RedBlackTree::Intersection);
+	}
+
+	void set_intersection(ThreadPool& pool, RedBlackTree& other)
+	{
+		setOperation(&pool, other, &RedBlackTree::Intersection);
+	}
+
+	//  (this - other)
+	void set_difference(RedBlackTree& other)
+	{
+		setOperation(nullptr, other, &RedBlackTree::Difference);
+	}
+
+	void set_difference(ThreadPool& pool, RedBlackTree& other)
+	{
+		setOperation(&pool, other, &RedBlackTree::Difference);
+	}
+
+	//
+
+	// Observers
+
+	inline key_compare key_comp() const
+	{
+		return mCompare;
+	}
+
+	inline allocator_type get_allocator() const
+	{
+		return allocator_type(mPool.get_allocator());
+	}
+
+	//
+
+	void Print()
+	{
+		RedBlackTreeClearConsole();
+		Print(mRoot, 10, 0);
+	}
+
+	void Print(NodeBase* node, int x, int y)
+	{
+		if (node == mNil)
+		{
+			return;
+		}
+
+		std::ostringstream text;
+		text << static_cast<Node*>(node)->value.first;
+
+		RedBlackTreePrintNode(text.str(), node->color(), x, y);
+		Print(node->left, x - (5 / (y + 1)), y + 1);
+		Print(node->right, x + (5 / (y + 1)), y + 1);
+	}
 
 private:
-	Node* mRoot = nullptr;
-	Node* mNil = nullptr;
-};
+	static const Key& KeyOf(NodeBase* node)
+	{
+		return static_cast<Node*>(node)->value.first;
+	}
+
+	NodeBase* Search(const Key& key) const
+	{
+		NodeBase* node = mRoot;
+
+		while (node != mNil)
+		{
+			if (mCompare(key, KeyOf(node)))
+			{
+				node = node->left;
+			}
+			else if (mCompare(KeyOf(node), key))
+			{
+				node = node->right;
+			}
+			else
+			{
+				return node;
+			}
+		}
+
+		return mNil;
+	}
+
+	NodeBase* LowerBound(const Key& key) const
+	{
+		NodeBase* node = mRoot;
+		NodeBase* result = mNil;
+
+		while (node != mNil)
+		{
+			if (mCompare(KeyOf(node), key))
+			{
+				node = node->right;
+			}
+			else
+			{
+				result = node;
+				node = node->left;
+			}
+		}
+
+		return result;
+	}
+
+	NodeBase* UpperBound(const Key& key) const
+	{
+		NodeBase* node = mRoot;
+		NodeBase* result = mNil;
+
+		while (node != mNil)
+		{
+			if (mCompare(key, KeyOf(node)))
+			{
+				result = node;
+				node = node->left;
+			}
+			else
+			{
+				node = node->right;
+			}
+		}
+
+		return result;
+	}
+
+	NodeBase* Select(size_t k) const
+	{
+		NodeBase* node = mRoot;
+
+		while (node != mNil)
+		{
+			const size_t leftSize = node->left->size;
+
+			if (k < leftSize)
+			{
+				node = node->left;
+			}
+			else if (k == leftSize)
+			{
+				return node;
+			}
+			else
+			{
+				k -= leftSize + 1;
+				node = node->right;
+			}
+		}
+
+		return mNil;
+	}
+
+	NodeBase* Min(NodeBase* node) const
+	{
+		if (node == mNil)
+		{
+			return mNil;
+		}
+
+		while (node->left != mNil)
+		{
+			node = node->left;
+		}
+
+		return node;
+	}
+
+	NodeBase* Max(NodeBase* node) const
+	{
+		if (node == mNil)
+		{
+			return mNil;
+		}
+
+		while (node->right != mNil)
+		{
+			node = node->right;
+		}
+
+		return node;
+	}
+
+	NodeBase* Next(NodeBase* node) const
+	{
+		if (node->right != mNil)
+		{
+			return Min(node->right);
+		}
+
+		NodeBase* parent = node->parent();
+
+		while (parent != mNil && node == parent->right)
+		{
+			node = parent;
+			parent = parent->parent();
+		}
+
+		return parent;
+	}
+
+	// NIL (end)   
+	NodeBase* Prev(NodeBase* node) const
+	{
+		if (node == mNil)
+		{
+			return Max(mRoot);
+		}
+
+		if (node->left != mNil)
+		{
+			return Max(node->left);
+		}
+
+		NodeBase* parent = node->parent();
 
+		while (parent != mNil && node == parent->left)
+		{
+			node = parent;
+			parent = parent->parent();
+		}
+
+		return parent;
+	}
+
+	// key ̹   ,  mNil ְ parent Ŵ ڸ ´.
+	NodeBase* findInsertPosition(const Key& key, NodeBase*& parent) const
+	{
+		NodeBase* node = mRoot;
+		parent = mNil;
+
+		while (node != mNil)
+		{
+			parent = node;
+
+			if (mCompare(key, KeyOf(node)))
+			{
+				node = node->left;
+			}
+			else if (mCompare(KeyOf(node), key))
+			{
+				node = node->right;
+			}
+			else
+			{
+				return node;
+			}
+		}
+
+		return mNil;
+	}
+
+	NodeBase* insertNode(Node* newNode, NodeBase* parent)
+	{
+		newNode->set_parent(parent);
+
+		if (parent == mNil)
+		{
+			mRoot = newNode;
+		}
+		else if (mCompare(newNode->value.first, KeyOf(parent)))
+		{
+			parent->left = newNode;
+		}
+		else
+		{
+			parent->right = newNode;
+		}
+
+		// ˻
+		newNode->left = mNil;
+		newNode->right = mNil;
+		newNode->set_color(eColor::Red);
+		newNode->size = 1;
+
+		//     Ұ ϳ þ.
+		for (NodeBase* node = parent; node != mNil; node = node->parent())
+		{
+			node->size++;
+		}
+
+		mSize++;
+		InsertFixup(newNode);
+
+		return newNode;
+	}
+
+	void InsertFixup(NodeBase* node)
+	{
+		// 1) p = red, uncle = red
+		// -> p = black, uncle = black, pp = red  ٲ
+		// 2) p = red, uncle = black (triangle)
+		// -> ȸ  case 3 ٲ
+		// 3) p = red, uncle = black (list)
+		// ->   + ȸ
+
+		while (node->parent()->color() == eColor::Red)
+		{
+			if (node->parent() == node->parent()->parent()->left)
+			{
+				NodeBase* uncle = node->parent()->parent()->right;
+
+				if (uncle->color() == eColor::Red)
+				{
+					node->parent()->set_color(eColor::Black);
+					uncle->set_color(eColor::Black);
+					node->parent()->parent()->set_color(eColor::Red);
+					//   ٲپ node->parent->parent->parent
+					//  Red   ٲ ϱ  node node->parent->parent
+					//  ٲپ ݺ ǰԲ Ѵ.
+					node = node->parent()->parent();
+				}
+				else
+				{
+					// Triangle Ÿ
+					//          [pp(B)]
+					//     [p(R)]     [u(B)]
+					//         [n(R)]
+					//
+					//  LeftRotate ->
+					//
+					//          [pp(B)]
+					//     [p(R)]     [u(B)]
+					//  [n(R)]
+					if (node == node->parent()->right)
+					{
+						node = node->parent();
+						LeftRotate(node);
+					}
+
+					// ListŸ
+					//          [pp(R)]
+					//      [p(B)]    [u(B)]
+					//  [n(R)]
+					//
+					//  RightRotate ->
+					//
+					//           [p(B)]
+					//       [n(R)]   [pp(R)]
+					//                     [u(B)]
+
+					node->parent()->set_color(eColor::Black);
+					node->parent()->parent()->set_color(eColor::Red);
+					RightRotate(node->parent()->parent());
+				}
+			}
+			else // ݴ
+			{
+				NodeBase* uncle = node->parent()->parent()->left;
+
+				if (uncle->color() == eColor::Red)
+				{
+					node->parent()->set_color(eColor::Black);
+					uncle->set_color(eColor::Black);
+					node->parent()->parent()->set_color(eColor::Red);
+					node = node->parent()->parent();
+				}
+				else
+				{
+					// Triangle Ÿ
+					if (node == node->parent()->left)
+					{
+						node = node->parent();
+						RightRotate(node);
+					}
+
+					// List Ÿ
+					node->parent()->set_color(eColor::Black);
+					node->parent()->parent()->set_color(eColor::Red);
+					LeftRotate(node->parent()->parent());
+				}
+			}
+		}
+
+		mRoot->set_color(eColor::Black);
+	}
+
+	// 带 ű ʰ ũ ٲ . (CLRS RB-DELETE)
+	//   忡   Ƿ ٸ  ݺڰ ״ ȿϰ Ű const ȴ.
+	void Delete(NodeBase* node)
+	{
+		NodeBase* y = node;          // Ʈ ų ڸ ű 
+		eColor originalColor = y->color();
+		NodeBase* x = nullptr;       // y ڸ ä  (NIL  )
+
+		if (node->left == mNil)
+		{
+			x = node->right;
+			ShrinkAncestors(node);
+			Transplant(node, node->right);
+		}
+		else if (node->right == mNil)
+		{
+			x = node->left;
+			ShrinkAncestors(node);
+			Transplant(node, node->left);
+		}
+		else
+		{
+			//  带 node ڸ ű.
+			y = Min(node->right);
+			originalColor = y->color();
+			x = y->right;
+
+			// y  ڸ  ϳ δ. node y ̶ Բ پ.
+			ShrinkAncestors(y);
+
+			if (y->parent() == node)
+			{
+				x->set_parent(y);
+			}
+			else
+			{
+				Transplant(y, y->right);
+				y->right = node->right;
+				y->right->set_parent(y);
+			}
+
+			Transplant(node, y);
+			y->left = node->left;
+			y->left->set_parent(y);
+			y->set_color(node->color());
+			y->size = node->size;
+		}
+
+		destroyNode(static_cast<Node*>(node));
+		mSize--;
+
+		if (originalColor == eColor::Black)
+		{
+			DeleteFixup(x);
+		}
+	}
+
+	// node       ϳ δ.
+	void ShrinkAncestors(NodeBase* node)
+	{
+		for (NodeBase* parent = node->parent(); parent != mNil; parent = parent->parent())
+		{
+			parent->size--;
+		}
+	}
+
+	void DeleteFixup(NodeBase* node)
+	{
+		NodeBase* x = node;
+
+		while (x != mRoot && x->color() == eColor::Black)
+		{
+			if (x == x->parent()->left)
+			{
+				NodeBase* s = x->parent()->right;
+				if (s->color() == eColor::Red)
+				{
+					s->set_color(eColor::Black);
+					x->parent()->set_color(eColor::Red);
+					LeftRotate(x->parent());
+					s = x->parent()->right;
+				}
+
+				if (s->left->color() == eColor::Black && s->right->color() == eColor::Black)
+				{
+					s->set_color(eColor::Red);
+					x = x->parent();
+				}
+				else
+				{
+					if (s->right->color() == eColor::Black)
+					{
+						s->left->set_color(eColor::Black);
+						s->set_color(eColor::Red);
+						RightRotate(s);
+						s = x->parent()->right;
+					}
+
+					s->set_color(x->parent()->color());
+					x->parent()->set_color(eColor::Black);
+					s->right->set_color(eColor::Black);
+					LeftRotate(x->parent());
+					x = mRoot;
+				}
+			}
+			else
+			{
+				NodeBase* s = x->parent()->left;
+				if (s->color() == eColor::Red)
+				{
+					s->set_color(eColor::Black);
+					x->parent()->set_color(eColor::Red);
+					RightRotate(x->parent());
+					s = x->parent()->left;
+				}
+
+				if (s->right->color() == eColor::Black && s->left->color() == eColor::Black)
+				{
+					s->set_color(eColor::Red);
+					x = x->parent();
+				}
+				else
+				{
+					if (s->left->color() == eColor::Black)
+					{
+						s->right->set_color(eColor::Black);
+						s->set_color(eColor::Red);
+						LeftRotate(s);
+						s = x->parent()->left;
+					}
+
+					s->set_color(x->parent()->color());
+					x->parent()->set_color(eColor::Black);
+					s->left->set_color(eColor::Black);
+					RightRotate(x->parent());
+					x = mRoot;
+				}
+			}
+		}
+
+		x->set_color(eColor::Black);
+	}
+
+	// u Ʈ ڸ v Ʈ Ŵܴ. u  ʴ´.
+	// v NIL̾ parent  DeleteFixup ö  ְ Ѵ.
+	void Transplant(NodeBase* u, NodeBase* v)
+	{
+		if (u->parent() == mNil)
+		{
+			mRoot = v;
+		}
+		else if (u == u->parent()->left)
+		{
+			u->parent()->left = v;
+		}
+		else
+		{
+			u->parent()->right = v;
+		}
+
+		v->set_parent(u->parent());
+	}
+
+	//     [y]
+	//  [x]   [3]
+	// [1][2]
+
+	//     [x]
+	//  [1]   [y]
+	//       [2][3]
+
+	void LeftRotate(NodeBase* x)
+	{
+		NodeBase* y = x->right;
+
+		x->right = y->left;
+
+		if (y->left != mNil)
+		{
+			y->left->set_parent(x);
+		}
+
+		y->set_parent(x->parent());
+
+		if (x->parent() == mNil)
+		{
+			mRoot = y;
+		}
+		else if (x == x->parent()->left)
+		{
+			x->parent()->left = y;
+		}
+		else
+		{
+			x->parent()->right = y;
+		}
+
+		y->left = x;
+		x->set_parent(y);
+
+		// y x Ʈ ״ ޴´.
+		y->size = x->size;
+		x->size = x->left->size + x->right->size + 1;
+	}
+
+	void RightRotate(NodeBase* y)
+	{
+		NodeBase* x = y->left;
+
+		y->left = x->right;
+
+		if (x->right != mNil)
+		{
+			x->right->set_parent(y);
+		}
+
+		x->set_parent(y->parent());
+
+		if (x->parent() == mNil)
+		{
+			mRoot = x;
+		}
+		else if (y == y->parent()->left)
+		{
+			y->parent()->left = x;
+		}
+		else
+		{
+			y->parent()->right = x;
+		}
+
+		x->right = y;
+		y->set_parent(x);
+
+		x->size = y->size;
+		y->size = y->left->size + y->right->size + 1;
+	}
+
+	template<typename... Args>
+	Node* createNode(Args&&... args)
+	{
+		Node* node = mPool.allocate();
+
+		try
+		{
+			::new (static_cast<void*>(node)) Node(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			mPool.deallocate(node);
+			throw;
+		}
+
+		return node;
+	}
+
+	void destroyNode(Node* node)
+	{
+		node->~Node();
+		mPool.deallocate(node);
+	}
+
+	void destroyTree(NodeBase* node)
+	{
+		if (node == mNil)
+		{
+			return;
+		}
+
+		destroyTree(node->left);
+		destroyTree(node->right);
+		destroyNode(static_cast<Node*>(node));
+	}
+
+	// ޸𸮴  ʴ´. (clear Ǯ° ش)
+	void destroyValues(NodeBase* node)
+	{
+		if (node == mNil)
+		{
+			return;
+		}
+
+		destroyValues(node->left);
+		destroyValues(node->right);
+		static_cast<Node*>(node)->~Node();
+	}
+
+	//   ״ Ѵ. O(N)
+	// MoveValues  ű. ű ܰ   ִ    Ѵ.
+	template<bool MoveValues = false>
+	NodeBase* copyTree(NodeBase* node, NodeBase* otherNil, NodeBase* parent)
+	{
+		if (node == otherNil)
+		{
+			return mNil;
+		}
+
+		Node* copy = nullptr;
+
+		if constexpr (MoveValues)
+		{
+			copy = createNode(std::move_if_noexcept(static_cast<Node*>(node)->value));
+		}
+		else
+		{
+			copy = createNode(static_cast<Node*>(node)->value);
+		}
+		copy->set_parent(parent);
+		copy->set_color(node->color());
+		copy->size = node->size;
+		copy->left = mNil;
+		copy->right = mNil;
+
+		try
+		{
+			copy->left = copyTree<MoveValues>(node->left, otherNil, copy);
+			copy->right = copyTree<MoveValues>(node->right, otherNil, copy);
+		}
+		catch (...)
+		{
+			destroyTree(copy);
+			throw;
+		}
+
+		return copy;
+	}
+
+	// first count   Ʈ  first ׸ŭ ű.
+	// prev ٷ տ   ( ˻)
+	template<typename ForwardIt>
+	NodeBase* buildSubtree(ForwardIt& first, size_t count, size_t depth, size_t redDepth, NodeBase*& prev)
+	{
+		if (count == 0)
+		{
+			return mNil;
+		}
+
+		const size_t leftCount = (count - 1) / 2;
+
+		NodeBase* left = buildSubtree(first, leftCount, depth + 1, redDepth, prev);
+		Node* node = nullptr;
+
+		try
+		{
+			node = createNode(*first);
+		}
+		catch (...)
+		{
+			destroyTree(left);
+			throw;
+		}
+
+		assert(prev == mNil || mCompare(KeyOf(prev), node->value.first));
+		prev = node;
+		++first;
+
+		NodeBase* right = mNil;
+
+		try
+		{
+			right = buildSubtree(first, count - 1 - leftCount, depth + 1, redDepth, prev);
+		}
+		catch (...)
+		{
+			destroyTree(left);
+			destroyNode(node);
+			throw;
+		}
+
+		node->left = left;
+		node->right = right;
+		node->set_color(depth == redDepth ? eColor::Red : eColor::Black);
+		node->size = count;
+
+		if (left != mNil)
+		{
+			left->set_parent(node);
+		}
+
+		if (right != mNil)
+		{
+			right->set_parent(node);
+		}
+
+		return node;
+	}
+
+	// Ʈ ٲٰ   Ʈ д´.
+	void setRoot(NodeBase* root)
+	{
+		mRoot = root;
+
+		if (root != mNil)
+		{
+			root->set_parent(mNil);
+			root->set_color(eColor::Black);
+		}
+
+		mSize = root->size;
+	}
+
+	//    Black   (NIL  ʴ´)
+	size_t BlackHeight(NodeBase* node) const
+	{
+		size_t height = 0;
+
+		for (; node != mNil; node = node->left)
+		{
+			if (node->color() == eColor::Black)
+			{
+				height++;
+			}
+		}
+
+		return height;
+	}
+
+	// θ Black̰  ̰ parentHeight  child    Ʈ .
+	// Red Ʈ Black ĥϹǷ  ̰ ϳ þ.
+	Subtree Detach(NodeBase* child, size_t parentHeight)
+	{
+		if (child == mNil)
+		{
+			return { mNil, 0 };
+		}
+
+		child->set_parent(mNil);
+
+		if (child->color() == eColor::Red)
+		{
+			child->set_color(eColor::Black);
+			return { child, parentHeight };
+		}
+
+		return { child, parentHeight - 1 };
+	}
+
+	// node ڽ left, right ٲٰ   ٽ .
+	NodeBase* Link(NodeBase* left, NodeBase* node, NodeBase* right, eColor color)
+	{
+		node->left = left;
+		node->right = right;
+		node->size = left->size + right->size + 1;
+		node->set_color(color);
+
+		if (left != mNil)
+		{
+			left->set_parent(node);
+		}
+
+		if (right != mNil)
+		{
+			right->set_parent(node);
+		}
+
+		return node;
+	}
+
+	// LeftRotate, RightRotate  mRoot  ũ ǵ帮 ʰ  Ʈ Ʈ ش.
+	//  꿡  尡  ٸ Ʈ ÿ ȸϱ ̴.
+	NodeBase* RotateLeftLocal(NodeBase* x)
+	{
+		NodeBase* y = x->right;
+
+		x->right = y->left;
+
+		if (y->left != mNil)
+		{
+			y->left->set_parent(x);
+		}
+
+		y->left = x;
+		x->set_parent(y);
+
+		y->size = x->size;
+		x->size = x->left->size + x->right->size + 1;
+
+		return y;
+	}
+
+	NodeBase* RotateRightLocal(NodeBase* y)
+	{
+		NodeBase* x = y->left;
+
+		y->left = x->right;
+
+		if (x->right != mNil)
+		{
+			x->right->set_parent(y);
+		}
+
+		x->right = y;
+		y->set_parent(x);
+
+		x->size = y->size;
+		y->size = y->left->size + y->right->size + 1;
+
+		return x;
+	}
+
+	// node   θ   ̰ right  Black  c 
+	// c ڸ Red node(c, right) Ŵܴ. ö鼭 Red-Red  ȸ Ǭ.
+	NodeBase* JoinRight(NodeBase* node, size_t height, NodeBase* middle, Subtree right)
+	{
+		if (node->color() == eColor::Black && height == right.blackHeight)
+		{
+			return Link(node, middle, right.root, eColor::Red);
+		}
+
+		const size_t childHeight = (node->color() == eColor::Black) ? height - 1 : height;
+		NodeBase* child = JoinRight(node->right, childHeight, middle, right);
+
+		Link(node->left, node, child, node->color());
+
+		if (node->color() == eColor::Black && child->color() == eColor::Red && child->right->color() == eColor::Red)
+		{
+			child->right->set_color(eColor::Black);
+			return RotateLeftLocal(node);
+		}
+
+		return node;
+	}
+
+	NodeBase* JoinLeft(NodeBase* node, size_t height, NodeBase* middle, Subtree left)
+	{
+		if (node->color() == eColor::Black && height == left.blackHeight)
+		{
+			return Link(left.root, middle, node, eColor::Red);
+		}
+
+		const size_t childHeight = (node->color() == eColor::Black) ? height - 1 : height;
+		NodeBase* child = JoinLeft(node->left, childHeight, middle, left);
+
+		Link(child, node, node->right, node->color());
+
+		if (node->color() == eColor::Black && child->color() == eColor::Red && child->left->color() == eColor::Red)
+		{
+			child->left->set_color(eColor::Black);
+			return RotateRightLocal(node);
+		}
+
+		return node;
+	}
+
+	// left  Ű < middle Ű < right  Ű.  Ʈ Black. O(|  |)
+	Subtree Join(Subtree left, NodeBase* middle, Subtree right)
+	{
+		Subtree result;
+
+		if (left.blackHeight > right.blackHeight)
+		{
+			result = { JoinRight(left.root, left.blackHeight, middle, right), left.blackHeight };
+		}
+		else if (left.blackHeight < right.blackHeight)
+		{
+			result = { JoinLeft(right.root, right.blackHeight, middle, left), right.blackHeight };
+		}
+		else
+		{
+			result = { Link(left.root, middle, right.root, eColor::Black), left.blackHeight + 1 };
+		}
+
+		result.root->set_parent(mNil);
+
+		if (result.root->color() == eColor::Red)
+		{
+			result.root->set_color(eColor::Black);
+			result.blackHeight++;
+		}
+
+		return result;
+	}
+
+	//    մ´. left  带   .
+	Subtree Concat(Subtree left, Subtree right)
+	{
+		if (left.root == mNil)
+		{
+			return right;
+		}
+
+		if (right.root == mNil)
+		{
+			return left;
+		}
+
+		std::pair<Subtree, NodeBase*> last = SplitLast(left);
+		return Join(last.first, last.second, right);
+	}
+
+	//    Ʈ .
+	std::pair<Subtree, NodeBase*> SplitLast(Subtree tree)
+	{
+		NodeBase* root = tree.root;
+		Subtree left = Detach(root->left, tree.blackHeight);
+		Subtree right = Detach(root->right, tree.blackHeight);
+
+		if (right.root == mNil)
+		{
+			return { left, root };
+		}
+
+		std::pair<Subtree, NodeBase*> last = SplitLast(right);
+		return { Join(left, root, last.first), last.second };
+	}
+
+	// key  , ū , key  ( NIL) .  θ  ö joinѴ.
+	SplitResult Split(Subtree tree, const Key& key)
+	{
+		if (tree.root == mNil)
+		{
+			return { { mNil, 0 }, mNil, { mNil, 0 } };
+		}
+
+		NodeBase* root = tree.root;
+		Subtree left = Detach(root->left, tree.blackHeight);
+		Subtree right = Detach(root->right, tree.blackHeight);
+
+		if (mCompare(key, KeyOf(root)))
+		{
+			SplitResult result = Split(left, key);
+			result.right = Join(result.right, root, right);
+			return result;
+		}
+
+		if (mCompare(KeyOf(root), key))
+		{
+			SplitResult result = Split(right, key);
+			result.left = Join(left, root, result.left);
+			return result;
+		}
+
+		Link(mNil, root, mNil, eColor::Black);
+		return { left, root, right };
+	}
+
+	//  ͸ Ѵ. pool ְ  Ұ  right ٸ 忡 ѱ.
+	template<typename LeftFunc, typename RightFunc>
+	void forkJoin(ThreadPool* pool, size_t size, LeftFunc&& left, RightFunc&& right)
+	{
+		if (pool != nullptr && size >= RedBlackTreeParallelGrain)
+		{
+			TaskGroup group(*pool);
+			group.run(right);
+			left();
+			group.wait();
+		}
+		else
+		{
+			left();
+			right();
+		}
+	}
+
+	// a Ʈ b   ģ.  Ű a 带 .
+	Subtree Union(Subtree a, Subtree b, Garbage& garbage, ThreadPool* pool)
+	{
+		if (a.root == mNil)
+		{
+			return b;
+		}
+
+		if (b.root == mNil)
+		{
+			return a;
+		}
+
+		const size_t size = a.root->size + b.root->size;
+
+		NodeBase* root = a.root;
+		Subtree aLeft = Detach(root->left, a.blackHeight);
+		Subtree aRight = Detach(root->right, a.blackHeight);
+		SplitResult parts = Split(b, KeyOf(root));
+
+		if (parts.found != mNil)
+		{
+			garbage.push(parts.found);
+		}
+
+		Subtree left, right;
+		Garbage rightGarbage;
+
+		forkJoin(pool, size,
+			[&]() { left = Union(aLeft, parts.left, garbage, pool); },
+			[&]() { right = Union(aRight, parts.right, rightGarbage, pool); });
+
+		garbage.append(rightGarbage);
+		return Join(left, root, right);
+	}
+
+	Subtree Intersection(Subtree a, Subtree b, Garbage& garbage, ThreadPool* pool)
+	{
+		if (a.root == mNil || b.root == mNil)
+		{
+			NodeBase* rest = (a.root == mNil) ? b.root : a.root;
+			if (rest != mNil)
+			{
+				garbage.push(rest);
+			}
+
+			return { mNil, 0 };
+		}
+
+		const size_t size = a.root->size + b.root->size;
+
+		NodeBase* root = a.root;
+		Subtree aLeft = Detach(root->left, a.blackHeight);
+		Subtree aRight = Detach(root->right, a.blackHeight);
+		SplitResult parts = Split(b, KeyOf(root));
+
+		Subtree left, right;
+		Garbage rightGarbage;
+
+		forkJoin(pool, size,
+			[&]() { left = Intersection(aLeft, parts.left, garbage, pool); },
+			[&]() { right = Intersection(aRight, parts.right, rightGarbage, pool); });
+
+		garbage.append(rightGarbage);
+
+		if (parts.found != mNil)
+		{
+			garbage.push(parts.found);
+			return Join(left, root, right);
+		}
+
+		garbage.push(Link(mNil, root, mNil, eColor::Black));
+		return Concat(left, right);
+	}
+
+	// a - b. b Ʈ a .
+	Subtree Difference(Subtree a, Subtree b, Garbage& garbage, ThreadPool* pool)
+	{
+		if (a.root == mNil || b.root == mNil)
+		{
+			if (b.root != mNil)
+			{
+				garbage.push(b.root);
+			}
+
+			return a;
+		}
+
+		const size_t size = a.root->size + b.root->size;
+
+		NodeBase* root = b.root;
+		Subtree bLeft = Detach(root->left, b.blackHeight);
+		Subtree bRight = Detach(root->right, b.blackHeight);
+		SplitResult parts = Split(a, KeyOf(root));
+
+		garbage.push(Link(mNil, root, mNil, eColor::Black));
+
+		if (parts.found != mNil)
+		{
+			garbage.push(parts.found);
+		}
+
+		Subtree left, right;
+		Garbage rightGarbage;
+
+		forkJoin(pool, size,
+			[&]() { left = Difference(parts.left, bLeft, garbage, pool); },
+			[&]() { right = Difference(parts.right, bRight, rightGarbage, pool); });
+
+		garbage.append(rightGarbage);
+		return Concat(left, right);
+	}
+
+	// node Ʒ oldNil Ű ũ newNil ٲ۴.
+	void relinkNil(NodeBase* node, NodeBase* oldNil, NodeBase* newNil, ThreadPool* pool)
+	{
+		if (node == oldNil)
+		{
+			return;
+		}
+
+		if (node->parent() == oldNil)
+		{
+			node->set_parent(newNil);
+		}
+
+		NodeBase* left = node->left;
+		NodeBase* right = node->right;
+
+		if (left == oldNil)
+		{
+			node->left = newNil;
+		}
+
+		if (right == oldNil)
+		{
+			node->right = newNil;
+		}
+
+		forkJoin(pool, node->size,
+			[&]() { relinkNil(left, oldNil, newNil, pool); },
+			[&]() { relinkNil(right, oldNil, newNil, pool); });
+	}
+
+	// other  Ǯ Ѱܹް other Ʈ ش. other  Ʈ ȴ.
+	// Ұ   尡 ū  NIL Ű ٲٰ  NIL  Ʈ NIL .
+	NodeBase* adopt(RedBlackTree& other, ThreadPool* pool)
+	{
+		assert(this != &other);
+
+		NodeBase* otherRoot = other.mRoot;
+
+		if (other.mSize <= mSize)
+		{
+			relinkNil(otherRoot, other.mNil, mNil, pool);
+
+			if (otherRoot == other.mNil)
+			{
+				otherRoot = mNil;
+			}
+		}
+		else
+		{
+			relinkNil(mRoot, mNil, other.mNil, pool);
+
+			if (mRoot == mNil)
+			{
+				mRoot = other.mNil;
+			}
+
+			std::swap(mNil, other.mNil);
+		}
+
+		mPool.merge(other.mPool);
+		other.mRoot = other.mNil;
+		other.mSize = 0;
+
+		return otherRoot;
+	}
+
+	template<typename Operation>
+	void setOperation(ThreadPool* pool, RedBlackTree& other, Operation operation)
+	{
+		if (this == &other)
+		{
+			// A - A  A  A, A  A ״
+			if (operation == &RedBlackTree::Difference)
+			{
+				clear();
+			}
+
+			return;
+		}
+
+		NodeBase* otherRoot = adopt(other, pool);
+
+		Garbage garbage;
+		Subtree result = (this->*operation)({ mRoot, BlackHeight(mRoot) }, { otherRoot, BlackHeight(otherRoot) }, garbage, pool);
+		setRoot(result.root);
+
+		for (NodeBase* node = garbage.head; node != nullptr;)
+		{
+			NodeBase* next = node->parent();
+			destroyTree(node);
+			node = next;
+		}
+	}
+
+private:
+	Compare mCompare;
+	NodePool<Node, NodeAllocator> mPool; //  Ǯ  ߶ .
+	NodeBase* mRoot = nullptr;
+	NodeBase* mNil = nullptr;
+	size_t mSize = 0;
+};
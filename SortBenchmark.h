@@ -0,0 +1,689 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "ExternalSort.h"
+#include "ThreadPool.h"
+#include "sort.h"
+
+//  ġũ
+// sort.h  ũ, Է   ð,  Ƚ, ̵ Ƚ, ߰ ޸𸮸   ´ ȮѴ.
+//  JSON     ȭ Ѵ.
+//
+//	SortBenchmarkConfig config;
+//	config.sizes = { 1000, 1000000 };
+//	auto results = RunSortBenchmark<uint32_t>(config);
+//	SaveSortBenchmarkJson<uint32_t>("sort.json", results);
+//
+// ð   .
+// - ð :   T comp ״ . ݺ  ߾Ӱ ּڰ
+// - , ̵, ߰ ޸ : Ҹ SortBenchmarkValue<T>     ϸ .
+//    Ŀ  Ʈũ  Ƿ    ķ  ̴.
+//   ߰ ޸𸮴 ÿ ִ   ִ񰪿 Է ũ⸦  ̴. (  )
+//      迭ó Ұ ƴ ۾   ʴ´.
+//   threadCounts    ,  Է¿ 1   ߾Ӱ  ӵ  ´.
+// 1  threadCounts   . ٸ  1   ̴.
+//
+// CheckExternalSort ExternalSorter     ޸  ȮѴ.
+// RunSortingNetworkBenchmark ũ⺰  Ʈũ   ȣ   ð .
+
+enum class SortDistribution
+{
+	Random,    //  
+	Sorted,    // ̹ ĵ
+	Reversed,  // 
+	FewUnique, // 16 
+	Zipf,      //  ϼ  ´. ( r 󵵰 1 / r^s)
+	OrganPipe, // 0, 1, ..., N/2, ..., 1, 0
+};
+
+inline const char* SortDistributionName(SortDistribution distribution)
+{
+	switch (distribution)
+	{
+	case SortDistribution::Random:    return "random";
+	case SortDistribution::Sorted:    return "sorted";
+	case SortDistribution::Reversed:  return "reversed";
+	case SortDistribution::FewUnique: return "few-unique";
+	case SortDistribution::Zipf:      return "zipf";
+	case SortDistribution::OrganPipe: return "organ-pipe";
+	}
+
+	return "unknown";
+}
+
+struct SortBenchmarkConfig
+{
+	std::vector<size_t> sizes = { 1 << 10, 1 << 16, 1 << 20 };
+	std::vector<SortDistribution> distributions = {
+		SortDistribution::Random, SortDistribution::Sorted, SortDistribution::Reversed,
+		SortDistribution::FewUnique, SortDistribution::Zipf, SortDistribution::OrganPipe };
+	unsigned repeats = 5;
+	uint64_t seed = 1;
+	double zipfExponent = 1.0;
+	size_t quadraticLimit = 1 << 12; // O(N^2)   ũ
+	std::vector<unsigned> threadCounts = { 1, 2, 4, 8 }; //    . 0̸ ϵ  
+};
+
+struct SortBenchmarkResult
+{
+	std::string algorithm;
+	SortDistribution distribution = SortDistribution::Random;
+	size_t size = 0;
+	unsigned threads = 1;
+	double nsPerElement = 0;    // ݺ  ߾Ӱ
+	double speedup = 1;         //  , Է 1  ߾Ӱ / nsPerElement
+	double minNsPerElement = 0; // ݺ  ּڰ
+	size_t comparisons = 0;
+	size_t moves = 0;           // ̵,    (swap 3)
+	size_t peakExtraBytes = 0;
+	bool sorted = false;        //  ĵǾ ִ°
+	bool permutation = false;   //  Է ġΰ
+};
+
+// , ̵ Ƚ ִ  
+//  ĵ   Ѵ.    ÿ   ȴ.
+struct SortBenchmarkCounters
+{
+	inline static std::atomic<size_t> comparisons = 0;
+	inline static std::atomic<size_t> moves = 0;
+	inline static std::atomic<size_t> live = 0;
+	inline static std::atomic<size_t> peakLive = 0;
+
+	static void reset()
+	{
+		comparisons = 0;
+		moves = 0;
+		peakLive = live.load();
+	}
+
+	static void construct()
+	{
+		size_t now = live.fetch_add(1, std::memory_order_relaxed) + 1;
+		size_t peak = peakLive.load(std::memory_order_relaxed);
+
+		while (now > peak && peakLive.compare_exchange_weak(peak, now, std::memory_order_relaxed) == false)
+		{
+		}
+	}
+
+	static void move()
+	{
+		moves.fetch_add(1, std::memory_order_relaxed);
+	}
+};
+
+// , Ű,    
+template<typename T>
+struct SortBenchmarkValue
+{
+	T value{};
+
+	SortBenchmarkValue()
+	{
+		SortBenchmarkCounters::construct();
+	}
+
+	explicit SortBenchmarkValue(T v)
+		: value(v)
+	{
+		SortBenchmarkCounters::construct();
+	}
+
+	SortBenchmarkValue(const SortBenchmarkValue& other)
+		: value(other.value)
+	{
+		SortBenchmarkCounters::construct();
+		SortBenchmarkCounters::move();
+	}
+
+	SortBenchmarkValue(SortBenchmarkValue&& other) noexcept
+		: value(other.value)
+	{
+		SortBenchmarkCounters::construct();
+		SortBenchmarkCounters::move();
+	}
+
+	~SortBenchmarkValue()
+	{
+		SortBenchmarkCounters::live.fetch_sub(1, std::memory_order_relaxed);
+	}
+
+	SortBenchmarkValue& operator=(const SortBenchmarkValue& other)
+	{
+		value = other.value;
+		SortBenchmarkCounters::move();
+		return *this;
+	}
+
+	SortBenchmarkValue& operator=(SortBenchmarkValue&& other) noexcept
+	{
+		value = other.value;
+		SortBenchmarkCounters::move();
+		return *this;
+	}
+};
+
+//   .
+template<typename Compare>
+struct SortBenchmarkCountingCompare
+{
+	Compare comp;
+
+	template<typename T>
+	bool operator()(const SortBenchmarkValue<T>& a, const SortBenchmarkValue<T>& b) const
+	{
+		SortBenchmarkCounters::comparisons.fetch_add(1, std::memory_order_relaxed);
+		return comp(a.value, b.value);
+	}
+};
+
+//   Ű
+struct SortBenchmarkKey
+{
+	template<typename T>
+	constexpr T operator()(const T& value) const noexcept
+	{
+		return value;
+	}
+
+	template<typename T>
+	constexpr T operator()(const SortBenchmarkValue<T>& value) const noexcept
+	{
+		return value.value;
+	}
+};
+
+template<typename T>
+std::string SortBenchmarkTypeName()
+{
+	if constexpr (std::is_floating_point_v<T>)
+	{
+		return sizeof(T) == sizeof(float) ? "float" : "double";
+	}
+	else
+	{
+		return std::string(std::is_signed_v<T> ? "int" : "uint") + std::to_string(sizeof(T) * 8);
+	}
+}
+
+//   n .  seed  Է
+template<typename T>
+std::vector<T> GenerateSortInput(SortDistribution distribution, size_t n, uint64_t seed, double zipfExponent = 1.0)
+{
+	static_assert(std::is_arithmetic_v<T>, "benchmark input must be arithmetic");
+
+	std::mt19937_64 rng(seed);
+	std::vector<T> values(n);
+
+	switch (distribution)
+	{
+	case SortDistribution::Random:
+		for (T& value : values)
+		{
+			if constexpr (std::is_floating_point_v<T>)
+			{
+				value = static_cast<T>(std::uniform_real_distribution<double>(-1.0, 1.0)(rng));
+			}
+			else
+			{
+				value = static_cast<T>(rng());
+			}
+		}
+		break;
+
+	case SortDistribution::Sorted:
+		for (size_t i = 0; i < n; i++)
+		{
+			values[i] = static_cast<T>(i);
+		}
+		break;
+
+	case SortDistribution::Reversed:
+		for (size_t i = 0; i < n; i++)
+		{
+			values[i] = static_cast<T>(n - i);
+		}
+		break;
+
+	case SortDistribution::FewUnique:
+		for (T& value : values)
+		{
+			value = static_cast<T>(rng() % 16);
+		}
+		break;
+
+	case SortDistribution::Zipf:
+	{
+		//   Ȯ  ŽѴ.  ִ 2^16
+		const size_t ranks = std::max<size_t>(1, std::min<size_t>(n, 1 << 16));
+		std::vector<double> cumulative(ranks);
+		double sum = 0;
+
+		for (size_t r = 0; r < ranks; r++)
+		{
+			sum += 1.0 / std::pow(static_cast<double>(r + 1), zipfExponent);
+			cumulative[r] = sum;
+		}
+
+		std::uniform_real_distribution<double> uniform(0.0, sum);
+
+		for (T& value : values)
+		{
+			size_t rank = std::lower_bound(cumulative.begin(), cumulative.end(), uniform(rng)) - cumulative.begin();
+			value = static_cast<T>(std::min(rank, ranks - 1));
+		}
+		break;
+	}
+
+	case SortDistribution::OrganPipe:
+		for (size_t i = 0; i < n; i++)
+		{
+			values[i] = static_cast<T>(i < n / 2 ? i : n - 1 - i);
+		}
+		break;
+	}
+
+	return values;
+}
+
+// ġũ  ϳ visit(̸, O(N^2),  Լ) ѱ.
+//  Լ (first, last, comp) ޴ ׸ ٶ T SortBenchmarkValue<T> ο .
+//   visitParallel(̸,  Լ) ѱ,  Լ (pool, first, last, comp) ޴´.
+//   comp  ʰ Ű θ ϹǷ comp   ѱ.
+template<typename T, typename Compare, typename Visitor, typename ParallelVisitor>
+void ForEachBenchmarkSort(Visitor&& visit, ParallelVisitor&& visitParallel)
+{
+	visit("BubbleSort", true, [](auto first, auto last, auto comp) { BubbleSort(first, last, comp); });
+	visit("SelectionSort", true, [](auto first, auto last, auto comp) { SelectionSort(first, last, comp); });
+	visit("InsertionSort", true, [](auto first, auto last, auto comp) { InsertionSort(first, last, comp); });
+	visit("HeapSort", false, [](auto first, auto last, auto comp) { HeapSort(first, last, comp); });
+	visit("MergeSort", false, [](auto first, auto last, auto comp) { MergeSort(first, last, comp); });
+	visit("TimSort", false, [](auto first, auto last, auto comp) { TimSort(first, last, comp); });
+	visit("QuickSort", false, [](auto first, auto last, auto comp) { QuickSort(first, last, comp); });
+	visit("PdqSort", false, [](auto first, auto last, auto comp) { PdqSort(first, last, comp); });
+	visit("StableSort", false, [](auto first, auto last, auto comp) { StableSort(first, last, comp); });
+	visitParallel("ParallelMergeSort", [](ThreadPool& pool, auto first, auto last, auto comp) { ParallelMergeSort(pool, first, last, comp); });
+	visitParallel("ParallelQuickSort", [](ThreadPool& pool, auto first, auto last, auto comp) { ParallelQuickSort(pool, first, last, comp); });
+
+	if constexpr (std::is_integral_v<T> && SortingNetworkAscending<T, Compare>)
+	{
+		visit("RadixSort", false, [](auto first, auto last, auto) { RadixSort(first, last, SortBenchmarkKey()); });
+		visit("AmericanFlagSort", false, [](auto first, auto last, auto) { AmericanFlagSort(first, last, SortBenchmarkKey()); });
+	}
+
+	//  
+	visit("std::sort", false, [](auto first, auto last, auto comp) { std::sort(first, last, comp); });
+	visit("std::stable_sort", false, [](auto first, auto last, auto comp) { std::stable_sort(first, last, comp); });
+}
+
+//    Է¿  . expected input  
+template<typename T, typename Compare, typename SortFunc>
+SortBenchmarkResult MeasureSort(const char* name, SortFunc& sort, const std::vector<T>& input, const std::vector<T>& expected,
+	SortDistribution distribution, unsigned repeats, Compare comp)
+{
+	SortBenchmarkResult result;
+	result.algorithm = name;
+	result.distribution = distribution;
+	result.size = input.size();
+
+	const size_t n = input.size();
+	std::vector<T> work;
+	std::vector<double> times;
+
+	for (unsigned r = 0; r < std::max(repeats, 1u); r++)
+	{
+		work = input;
+
+		auto start = std::chrono::steady_clock::now();
+		sort(work.data(), work.data() + n, comp);
+		auto end = std::chrono::steady_clock::now();
+
+		times.push_back(std::chrono::duration<double, std::nano>(end - start).count() / std::max<size_t>(n, 1));
+
+		if (r == 0)
+		{
+			result.sorted = std::is_sorted(work.begin(), work.end(), comp);
+
+			std::vector<T> check = work;
+			std::sort(check.begin(), check.end(), comp);
+			result.permutation = check == expected;
+		}
+	}
+
+	std::sort(times.begin(), times.end());
+	result.nsPerElement = times[times.size() / 2];
+	result.minNsPerElement = times.front();
+
+	//  
+	{
+		std::vector<SortBenchmarkValue<T>> counted;
+		counted.reserve(n);
+
+		for (const T& value : input)
+		{
+			counted.emplace_back(value);
+		}
+
+		SortBenchmarkCounters::reset();
+		const size_t baseLive = SortBenchmarkCounters::live.load();
+
+		sort(counted.data(), counted.data() + n, SortBenchmarkCountingCompare<Compare>{ comp });
+
+		result.comparisons = SortBenchmarkCounters::comparisons.load();
+		result.moves = SortBenchmarkCounters::moves.load();
+		result.peakExtraBytes = (SortBenchmarkCounters::peakLive.load() - baseLive) * sizeof(T);
+	}
+
+	return result;
+}
+
+// config  ũ, ,   .
+template<typename T, typename Compare = std::less<>>
+std::vector<SortBenchmarkResult> RunSortBenchmark(const SortBenchmarkConfig& config, Compare comp = Compare())
+{
+	// 1  Ǯ  տ ξ ӵ   .
+	std::vector<std::unique_ptr<ThreadPool>> pools;
+	pools.push_back(std::make_unique<ThreadPool>(1));
+
+	for (unsigned threads : config.threadCounts)
+	{
+		threads = (threads == 0) ? HardwareThreadCount() : threads;
+
+		if (threads != 1)
+		{
+			pools.push_back(std::make_unique<ThreadPool>(threads));
+		}
+	}
+
+	std::vector<SortBenchmarkResult> results;
+
+	for (size_t n : config.sizes)
+	{
+		for (SortDistribution distribution : config.distributions)
+		{
+			const std::vector<T> input = GenerateSortInput<T>(distribution, n, config.seed, config.zipfExponent);
+
+			std::vector<T> expected = input;
+			std::sort(expected.begin(), expected.end(), comp);
+
+			auto visit = [&](const char* name, bool quadratic, auto sort)
+			{
+				if (quadratic && n > config.quadraticLimit)
+				{
+					return;
+				}
+
+				results.push_back(MeasureSort(name, sort, input, expected, distribution, config.repeats, comp));
+			};
+
+			auto visitParallel = [&](const char* name, auto sort)
+			{
+				const size_t first = results.size();
+
+				for (const std::unique_ptr<ThreadPool>& pool : pools)
+				{
+					auto bound = [&](auto begin, auto end, auto compare) { sort(*pool, begin, end, compare); };
+
+					SortBenchmarkResult result = MeasureSort(name, bound, input, expected, distribution, config.repeats, comp);
+					result.threads = pool->size();
+
+					// ù Ǯ 1  ù  speedup 1̴.
+					const double baseline = results.size() > first ? results[first].nsPerElement : result.nsPerElement;
+					result.speedup = result.nsPerElement > 0 ? baseline / result.nsPerElement : 0;
+
+					results.push_back(result);
+				}
+			};
+
+			ForEachBenchmarkSort<T, Compare>(visit, visitParallel);
+		}
+	}
+
+	return results;
+}
+
+//  JSON .
+// { "type": "uint32", "results": [ { "algorithm": ..., "distribution": ..., "size": ..., ... }, ... ] }
+inline void WriteSortBenchmarkJson(FILE* file, const std::string& typeName, const std::vector<SortBenchmarkResult>& results)
+{
+	fprintf(file, "{\n  \"type\": \"%s\",\n  \"results\": [", typeName.c_str());
+
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const SortBenchmarkResult& r = results[i];
+
+		fprintf(file, "%s\n    { \"algorithm\": \"%s\", \"distribution\": \"%s\", \"size\": %zu, "
+			"\"threads\": %u, \"ns_per_element\": %.3f, \"min_ns_per_element\": %.3f, \"speedup\": %.3f, "
+			"\"comparisons\": %zu, \"moves\": %zu, \"peak_extra_bytes\": %zu, \"sorted\": %s, \"permutation\": %s }",
+			i == 0 ? "" : ",", r.algorithm.c_str(), SortDistributionName(r.distribution), r.size,
+			r.threads, r.nsPerElement, r.minNsPerElement, r.speedup, r.comparisons, r.moves,
+			r.peakExtraBytes, r.sorted ? "true" : "false", r.permutation ? "true" : "false");
+	}
+
+	fprintf(file, "\n  ]\n}\n");
+}
+
+template<typename T>
+bool SaveSortBenchmarkJson(const std::string& path, const std::vector<SortBenchmarkResult>& results)
+{
+	FILE* file = fopen(path.c_str(), "w");
+	if (file == nullptr)
+	{
+		return false;
+	}
+
+	WriteSortBenchmarkJson(file, SortBenchmarkTypeName<T>(), results);
+
+	bool ok = ferror(file) == 0;
+	ok = fclose(file) == 0 && ok;
+	return ok;
+}
+
+//   ǥ
+inline void PrintSortBenchmark(FILE* file, const std::vector<SortBenchmarkResult>& results)
+{
+	fprintf(file, "%-18s %-11s %10s %8s %10s %10s %8s %14s %14s %12s %s\n",
+		"algorithm", "input", "size", "threads", "ns/elem", "min", "speedup", "comparisons", "moves", "extra bytes", "ok");
+
+	for (const SortBenchmarkResult& r : results)
+	{
+		fprintf(file, "%-18s %-11s %10zu %8u %10.2f %10.2f %8.2f %14zu %14zu %12zu %s\n",
+			r.algorithm.c_str(), SortDistributionName(r.distribution), r.size, r.threads,
+			r.nsPerElement, r.minNsPerElement, r.speedup, r.comparisons, r.moves, r.peakExtraBytes,
+			(r.sorted && r.permutation) ? "ok" : "FAIL");
+	}
+}
+
+// ܺ  Ȯ
+//  ڵ n  directory  ExternalSorter ϰ
+//  ´,   ((  ġ   + ) * 2) ޸ ѵ ȿ  ȮѴ.
+//   .
+struct ExternalSortCheckResult
+{
+	size_t size = 0;
+	size_t memoryBytes = 0;
+	ExternalSortStats stats;
+	bool sorted = false;
+	bool permutation = false;
+	bool withinBudget = false;
+};
+
+template<typename T, typename Compare = std::less<T>>
+ExternalSortCheckResult CheckExternalSort(const std::string& directory, size_t n, size_t memoryBytes,
+	size_t ioBufferBytes = size_t(4) << 20, uint64_t seed = 1, Compare comp = Compare())
+{
+	ExternalSortCheckResult result;
+	result.size = n;
+	result.memoryBytes = memoryBytes;
+
+	const std::vector<T> input = GenerateSortInput<T>(SortDistribution::Random, n, seed);
+
+	const std::string name = "extsort_check_" + std::to_string(std::random_device()());
+	const std::string inputPath = (std::filesystem::path(directory) / (name + ".in")).string();
+	const std::string outputPath = (std::filesystem::path(directory) / (name + ".out")).string();
+
+	FILE* file = fopen(inputPath.c_str(), "wb");
+	if (file == nullptr)
+	{
+		return result;
+	}
+
+	const bool written = fwrite(input.data(), sizeof(T), n, file) == n;
+	fclose(file);
+
+	ExternalSorter<T, Compare> sorter(memoryBytes, directory, 0, ioBufferBytes, comp);
+
+	if (written && sorter.Sort(inputPath, outputPath))
+	{
+		result.stats = sorter.stats();
+
+		std::vector<T> output(n + 1);
+		file = fopen(outputPath.c_str(), "rb");
+
+		if (file != nullptr)
+		{
+			output.resize(fread(output.data(), sizeof(T), output.size(), file));
+			fclose(file);
+		}
+
+		std::vector<T> expected = input;
+		std::sort(expected.begin(), expected.end(), comp);
+
+		result.sorted = std::is_sorted(output.begin(), output.end(), comp);
+		result.permutation = output == expected;
+		result.withinBudget = (result.stats.mergeFanIn + 1) * 2 * result.stats.ioBufferBytes <= memoryBytes;
+	}
+
+	std::error_code error;
+	std::filesystem::remove(inputPath, error);
+	std::filesystem::remove(outputPath, error);
+
+	return result;
+}
+
+//  Ʈũ ġũ
+// ũ 8, 16, 32, 64   SortingNetwork<N> InsertionSort ϳ  ȣ   ns .
+//   int32, int64, float.  blocks ʷ  ð blocks , ݺ  ߾Ӱ .
+// smallSort SmallSort  Ŀ  Ʈũ . (int64 SSE4.2 ̻ ؾ )
+struct SortingNetworkBenchmarkConfig
+{
+	std::vector<size_t> sizes = { 8, 16, 32, 64 }; // 8, 16, 32, 64 ߿
+	size_t blocks = 1 << 10;
+	unsigned repeats = 11;
+	uint64_t seed = 1;
+};
+
+struct SortingNetworkBenchmarkResult
+{
+	std::string type;
+	std::string algorithm;
+	size_t size = 0;
+	double nsPerCall = 0;    // ݺ  ߾Ӱ
+	double minNsPerCall = 0; // ݺ  ּڰ
+	double speedup = 1;      //  , ũ InsertionSort ߾Ӱ / nsPerCall
+	bool smallSort = false;
+	bool sorted = false;     //   ĵǾ ִ°
+};
+
+template<typename T, size_t N>
+void MeasureSortingNetwork(const SortingNetworkBenchmarkConfig& config, std::vector<SortingNetworkBenchmarkResult>& results)
+{
+	const size_t blocks = std::max<size_t>(config.blocks, 1);
+	const std::vector<T> input = GenerateSortInput<T>(SortDistribution::Random, blocks * N, config.seed + N);
+	std::vector<T> work;
+
+	auto measure = [&](const char* name, auto sort)
+	{
+		std::vector<double> times;
+		bool sorted = true;
+
+		for (unsigned r = 0; r < std::max(config.repeats, 1u); r++)
+		{
+			work = input;
+
+			auto start = std::chrono::steady_clock::now();
+			for (size_t b = 0; b < blocks; b++)
+			{
+				sort(work.data() + b * N);
+			}
+			auto end = std::chrono::steady_clock::now();
+
+			times.push_back(std::chrono::duration<double, std::nano>(end - start).count() / blocks);
+
+			for (size_t b = 0; r == 0 && b < blocks; b++)
+			{
+				sorted = sorted && std::is_sorted(work.data() + b * N, work.data() + (b + 1) * N);
+			}
+		}
+
+		std::sort(times.begin(), times.end());
+
+		SortingNetworkBenchmarkResult result;
+		result.type = SortBenchmarkTypeName<T>();
+		result.algorithm = name;
+		result.size = N;
+		result.nsPerCall = times[times.size() / 2];
+		result.minNsPerCall = times.front();
+		result.smallSort = SortingNetworkSupported<T, std::less<>>;
+		result.sorted = sorted;
+		results.push_back(result);
+	};
+
+	measure("InsertionSort", [](T* a) { InsertionSort(a, a + N, std::less<>()); });
+	measure("SortingNetwork", [](T* a) { SortingNetwork<N>(a); });
+
+	SortingNetworkBenchmarkResult& insertion = results[results.size() - 2];
+	SortingNetworkBenchmarkResult& network = results.back();
+	network.speedup = network.nsPerCall > 0 ? insertion.nsPerCall / network.nsPerCall : 0;
+}
+
+template<typename T>
+void MeasureSortingNetworks(const SortingNetworkBenchmarkConfig& config, std::vector<SortingNetworkBenchmarkResult>& results)
+{
+	for (size_t n : config.sizes)
+	{
+		switch (n)
+		{
+		case 8:  MeasureSortingNetwork<T, 8>(config, results); break;
+		case 16: MeasureSortingNetwork<T, 16>(config, results); break;
+		case 32: MeasureSortingNetwork<T, 32>(config, results); break;
+		case 64: MeasureSortingNetwork<T, 64>(config, results); break;
+		}
+	}
+}
+
+inline std::vector<SortingNetworkBenchmarkResult> RunSortingNetworkBenchmark(
+	const SortingNetworkBenchmarkConfig& config = SortingNetworkBenchmarkConfig())
+{
+	std::vector<SortingNetworkBenchmarkResult> results;
+
+	MeasureSortingNetworks<int32_t>(config, results);
+	MeasureSortingNetworks<int64_t>(config, results);
+	MeasureSortingNetworks<float>(config, results);
+
+	return results;
+}
+
+//   ǥ
+inline void PrintSortingNetworkBenchmark(FILE* file, const std::vector<SortingNetworkBenchmarkResult>& results)
+{
+	fprintf(file, "%-6s %-15s %5s %10s %10s %8s %10s %s\n", "type", "algorithm", "size", "ns/call", "min", "speedup", "SmallSort", "ok");
+
+	for (const SortingNetworkBenchmarkResult& r : results)
+	{
+		fprintf(file, "%-6s %-15s %5zu %10.2f %10.2f %8.2f %10s %s\n",
+			r.type.c_str(), r.algorithm.c_str(), r.size, r.nsPerCall, r.minNsPerCall, r.speedup,
+			r.smallSort ? "network" : "insertion", r.sorted ? "ok" : "FAIL");
+	}
+}
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ϵ  .    1.
+inline unsigned HardwareThreadCount()
+{
+	unsigned count = std::thread::hardware_concurrency();
+	return count == 0 ? 1 : count;
+}
+
+// ۾ ġ (work-stealing)  Ǯ
+// 帶 ڱ ۾  .
+// - ڱ  ڿ .   ۾̶  Ͱ ĳÿ  ִ.
+// -   ٸ   տ ģ.     ۾  ū ۾̴.
+// Ǯ  尡  ۾  ť .
+//
+//   threadCount - 1̰,  ϳ TaskGroup::wait ٸ .
+// ٸ   嵵   ۾  óϹǷ
+// ۾ ȿ ۾  ٷ ( ) 尡 ڶ  ʴ´.
+//  ۾   ٸ 尡 ó  ۾ CPU 纸Ѵ.
+// ۾ ܸ  ʾƾ Ѵ.
+class ThreadPool
+{
+public:
+	using Task = std::function<void()>;
+
+	// constructor
+
+	explicit ThreadPool(unsigned threadCount = 0)
+		: mThreadCount(threadCount == 0 ? HardwareThreadCount() : threadCount)
+		, mQueues(mThreadCount)
+	{
+		mThreads.reserve(mThreadCount - 1);
+		for (unsigned i = 0; i + 1 < mThreadCount; i++)
+		{
+			mThreads.emplace_back(&ThreadPool::workerLoop, this, i);
+		}
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	~ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			mStop = true;
+		}
+
+		mSleepCondition.notify_all();
+
+		for (auto& thread : mThreads)
+		{
+			thread.join();
+		}
+	}
+
+	//
+
+	// ٸ 带   
+	inline unsigned size() const
+	{
+		return mThreadCount;
+	}
+
+	// Ǯ 忡 θ ڱ , ƴϸ  ť ִ´.
+	void submit(Task task)
+	{
+		WorkQueue& queue = (tlsPool == this) ? mQueues[tlsIndex] : mQueues.back();
+
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.tasks.push_back(std::move(task));
+		}
+
+		mQueued.fetch_add(1, std::memory_order_release);
+
+		//  尡 mQueued Ȯ     ȣ ġ ʵ   ᰬ Ǭ.
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+
+		mSleepCondition.notify_one();
+		mHelperCondition.notify_all();
+	}
+
+	//   ۾ ϳ  忡 Ѵ.  false.
+	bool run_pending_task()
+	{
+		Task task;
+
+		if (popTask(task) == false)
+		{
+			return false;
+		}
+
+		task();
+		return true;
+	}
+
+	// done() true     ۾  óѴ.
+	// ó ۾   ۾ ų notify_waiters Ҹ  .
+	template<typename Done>
+	void help_until(Done done)
+	{
+		while (done() == false)
+		{
+			if (run_pending_task())
+			{
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mHelperCondition.wait(lock, [this, &done]() { return done() || mQueued.load(std::memory_order_acquire) > 0; });
+		}
+	}
+
+	// help_until  带   ٽ Ȯϰ Ѵ.
+	void notify_waiters()
+	{
+		//  Ȯ     ȣ ġ ʵ   ᰬ Ǭ.
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+		}
+
+		mHelperCondition.notify_all();
+	}
+
+private:
+	struct WorkQueue
+	{
+		std::mutex mutex;
+		std::deque<Task> tasks;
+	};
+
+	static bool popBack(WorkQueue& queue, Task& task)
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+
+		if (queue.tasks.empty())
+		{
+			return false;
+		}
+
+		task = std::move(queue.tasks.back());
+		queue.tasks.pop_back();
+		return true;
+	}
+
+	static bool popFront(WorkQueue& queue, Task& task)
+	{
+		std::lock_guard<std::mutex> lock(queue.mutex);
+
+		if (queue.tasks.empty())
+		{
+			return false;
+		}
+
+		task = std::move(queue.tasks.front());
+		queue.tasks.pop_front();
+		return true;
+	}
+
+	// ڱ   ->  ť -> ٸ     ã´.
+	// mQueues  ĭ  ť (Ǯ   mThreadCount - 1  )
+	bool popTask(Task& task)
+	{
+		if (mQueued.load(std::memory_order_acquire) == 0)
+		{
+			return false;
+		}
+
+		const unsigned self = (tlsPool == this) ? tlsIndex : mThreadCount - 1;
+
+		bool found = popBack(mQueues[self], task);
+
+		if (found == false && self != mThreadCount - 1)
+		{
+			found = popFront(mQueues.back(), task);
+		}
+
+		for (unsigned i = 1; found == false && i < mThreadCount; i++)
+		{
+			found = popFront(mQueues[(self + i) % mThreadCount], task);
+		}
+
+		if (found)
+		{
+			mQueued.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		return found;
+	}
+
+	void workerLoop(unsigned index)
+	{
+		tlsPool = this;
+		tlsIndex = index;
+
+		Task task;
+
+		while (true)
+		{
+			if (popTask(task))
+			{
+				task();
+				task = nullptr;
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mSleepCondition.wait(lock, [this]() { return mStop || mQueued.load(std::memory_order_acquire) > 0; });
+
+			if (mStop)
+			{
+				return;
+			}
+		}
+	}
+
+private:
+	//  尡  Ǯ  ȿ ȣ
+	inline static thread_local ThreadPool* tlsPool = nullptr;
+	inline static thread_local unsigned tlsIndex = 0;
+
+	unsigned mThreadCount;
+	std::vector<WorkQueue> mQueues; // 帶 ϳ +  ť ( ĭ)
+	std::vector<std::thread> mThreads;
+
+	std::atomic<size_t> mQueued = 0; //  ť ִ ۾ 
+	std::mutex mSleepMutex;
+	std::condition_variable mSleepCondition;  //   Ǯ 
+	std::condition_variable mHelperCondition; // help_until ٸ 
+	bool mStop = false;
+};
+
+// Բ ٸ ۾ 
+// run  ۾    wait ٸ. Ҹڵ ٸ.
+class TaskGroup
+{
+public:
+	explicit TaskGroup(ThreadPool& pool)
+		: mPool(pool)
+	{}
+
+	TaskGroup(const TaskGroup&) = delete;
+	TaskGroup& operator=(const TaskGroup&) = delete;
+
+	~TaskGroup()
+	{
+		wait();
+	}
+
+	template<typename Func>
+	void run(Func&& func)
+	{
+		mPending.fetch_add(1, std::memory_order_relaxed);
+
+		//  ۾  wait ٷ ƿ     Ƿ Ǯ  Ƶд.
+		mPool.submit([this, &pool = mPool, func = std::forward<Func>(func)]() mutable
+			{
+				func();
+
+				if (mPending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					pool.notify_waiters();
+				}
+			});
+	}
+
+	// ٸ    ۾  óϰ, ó   .
+	void wait()
+	{
+		mPool.help_until([this]() { return mPending.load(std::memory_order_acquire) == 0; });
+	}
+
+private:
+	ThreadPool& mPool;
+	std::atomic<size_t> mPending = 0;
+};
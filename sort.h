@@ -1,67 +1,101 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
 #include <vector>
-#include <queue>
+#include "PriorityQueue.h"
+#include "ThreadPool.h"
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
 using namespace std;
 
+//     ݺ  [first, last)  Լ comp ޴´.
+// comp(a, b) true a b տ ´. (⺻ std::less<> -> )
+// data(), size()  ̳(std::vector, Vector) ̳ʸ ״ Ѱܵ ȴ.
+
 //  
 // (N-1) + (N-2) + ... + 2 + 1
 //   = N * (N-1) / 2
 // O(N^2)
-void BubbleSort(vector<int>& v)
+template<typename RandomIt, typename Compare = std::less<>>
+void BubbleSort(RandomIt first, RandomIt last, Compare comp = Compare())
 {
-	const int n = (int)v.size();
+	using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+	const Diff n = last - first;
 
-	for (int i = 0; i < n - 1; i++)
+	for (Diff i = 0; i < n - 1; i++)
 	{
-		for (int j = 0; j < n - 1 - i; j++)
+		for (Diff j = 0; j < n - 1 - i; j++)
 		{
-			if (v[j] > v[j + 1])
+			if (comp(first[j + 1], first[j]))
 			{
-				swap(v[j], v[j + 1]);
+				std::iter_swap(first + j, first + j + 1);
 			}
 		}
 	}
 }
 
+template<typename Container, typename Compare = std::less<>>
+auto BubbleSort(Container& v, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	BubbleSort(v.data(), v.data() + v.size(), comp);
+}
+
 //  
 // O(N^2)
-void SelectionSort(vector<int>& v)
+template<typename RandomIt, typename Compare = std::less<>>
+void SelectionSort(RandomIt first, RandomIt last, Compare comp = Compare())
 {
-	const int n = (int)v.size();
+	using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+	const Diff n = last - first;
 
-	for (int i = 0; i < n - 1; i++)
+	for (Diff i = 0; i < n - 1; i++)
 	{
-		int bestIdx = i;
+		Diff bestIdx = i;
 
-		for (int j = i + 1; j < n; j++)
+		for (Diff j = i + 1; j < n; j++)
 		{
-			if (v[j] < v[bestIdx])
+			if (comp(first[j], first[bestIdx]))
 			{
 				bestIdx = j;
 			}
 		}
 
-		swap(v[i], v[bestIdx]);
+		std::iter_swap(first + i, first + bestIdx);
 	}
 }
 
+template<typename Container, typename Compare = std::less<>>
+auto SelectionSort(Container& v, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	SelectionSort(v.data(), v.data() + v.size(), comp);
+}
+
 //  
 // O(N^2)
-void InsertionSort(vector<int>& v)
+template<typename RandomIt, typename Compare = std::less<>>
+void InsertionSort(RandomIt first, RandomIt last, Compare comp = Compare())
 {
-	const int n = (int)v.size();
+	using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+	const Diff n = last - first;
 
-	for (int i = 1; i < n; i++)
+	for (Diff i = 1; i < n; i++)
 	{
-		int insertData = v[i];
+		auto insertData = std::move(first[i]);
 
-		int j;
+		Diff j;
 		for (j = i - 1; j >= 0; j--)
 		{
-			if (v[j] > insertData)
+			if (comp(insertData, first[j]))
 			{
-				v[j + 1] = v[j];
+				first[j + 1] = std::move(first[j]);
 			}
 			else
 			{
@@ -69,30 +103,215 @@ void InsertionSort(vector<int>& v)
 			}
 		}
 
-		v[j + 1] = insertData;
+		first[j + 1] = std::move(insertData);
+	}
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto InsertionSort(Container& v, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	InsertionSort(v.data(), v.data() + v.size(), comp);
+}
+
+//  Ʈũ (Sorting Network)
+//  ġ    -ȯ Ѵ.      ٲ ʴ´.
+// -ȯ Ǻ   б  а ,
+//  ܰ  -ȯ  ̶ Ϸ   ´ SIMD  (SSE, AVX2 ) ´.
+// , Ǽ Ҹ std::less, std::greater     ⺻ ķ .
+// Ǽ NaN ̸ (ٸ İ )   ʴ´.
+
+template<typename T, typename Compare>
+constexpr bool SortingNetworkAscending = std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>>;
+
+template<typename T, typename Compare>
+constexpr bool SortingNetworkDescending = std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<T>>;
+
+// 64Ʈ  SIMD 񱳴 SSE4.2 ִ.   (SSE2) Į󺸴    .
+#if defined(__AVX2__) || defined(__SSE4_2__) || defined(__aarch64__) || defined(_M_ARM64)
+constexpr bool SortingNetworkWideInteger = true;
+#else
+constexpr bool SortingNetworkWideInteger = false;
+#endif
+
+template<typename T, typename Compare>
+constexpr bool SortingNetworkSupported = std::is_arithmetic_v<T> && std::is_same_v<T, bool> == false
+	&& (std::is_integral_v<T> == false || sizeof(T) < 8 || SortingNetworkWideInteger)
+	&& (SortingNetworkAscending<T, Compare> || SortingNetworkDescending<T, Compare>);
+
+constexpr ptrdiff_t SortingNetworkMaxSize = 64;
+
+// a, b  , ū   ´.
+// min(b, a) max(a, b)     b, a ֹǷ -0.0 +0.0ó ٰ 񱳵Ǵ     ´.
+// (min(a, b), max(a, b)    a Ǿ b Ҵ´.)
+//  ´ Ϸ б  min, max  ϳ ٲ۴.
+template<typename T>
+inline void CompareExchange(T& a, T& b)
+{
+	const T low = std::min(b, a);
+	const T high = std::max(a, b);
+	a = low;
+	b = high;
+}
+
+// ũ K ϸ  ݰ   ſó (t <-> K-1-t) Ѵ.
+template<size_t N, size_t K, typename T>
+inline void BitonicMirrorStage(T* a)
+{
+	for (size_t base = 0; base < N; base += K)
+	{
+		for (size_t t = 0; t < K / 2; t++)
+		{
+			CompareExchange(a[base + t], a[base + K - 1 - t]);
+		}
+	}
+}
+
+// ũ 2J ϸ  ݰ    ڸ (t <-> t+J) Ѵ.
+template<size_t N, size_t J, typename T>
+inline void BitonicHalfCleanerStage(T* a)
+{
+	for (size_t base = 0; base < N; base += 2 * J)
+	{
+		for (size_t t = 0; t < J; t++)
+		{
+			CompareExchange(a[base + t], a[base + t + J]);
+		}
+	}
+
+	if constexpr (J > 1)
+	{
+		BitonicHalfCleanerStage<N, J / 2>(a);
+	}
+}
+
+// ũ K     ĵǾ    ü ϰ,  ũ Ѿ.
+template<size_t N, size_t K, typename T>
+inline void BitonicMergeStage(T* a)
+{
+	BitonicMirrorStage<N, K>(a);
+
+	if constexpr (K >= 4)
+	{
+		BitonicHalfCleanerStage<N, K / 4>(a);
+	}
+
+	if constexpr (K < N)
+	{
+		BitonicMergeStage<N, K * 2>(a);
+	}
+}
+
+//   Ʈũ (N 2 ŵ). 
+// ũ 2, 4, ..., N  , ĵ   ſ 񱳷    
+//  ݾ ̸   Ѵ.
+//  -ȯ  ̰ ܰ踶 ݺ Ƚ  ð  ־ SIMD  .
+// N(logN)(logN + 1) / 4   (N = 64 -> 672)
+template<size_t N, typename T>
+void SortingNetwork(T* a)
+{
+	static_assert(N >= 2 && (N & (N - 1)) == 0, "sorting network size must be a power of two");
+
+	BitonicMergeStage<N, 2>(a);
+}
+
+// n (N ) Nĭ 迭 ű  ĭ  ū  ä    n ´.
+template<size_t N, typename RandomIt>
+void SortingNetworkPadded(RandomIt first, ptrdiff_t n, bool descending)
+{
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+
+	T a[N];
+	const T padding = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max();
+
+	std::copy(first, first + n, a);
+	std::fill(a + n, a + N, padding);
+
+	SortingNetwork<N>(a);
+
+	if (descending)
+	{
+		std::reverse_copy(a, a + n, first);
+	}
+	else
+	{
+		std::copy(a, a + n, first);
 	}
 }
 
-void HeapSort(vector<int>& v)
+//   
+//  Ʈũ   ִ ҿ  Լ (SortingNetworkMaxSize ) Ʈũ, ƴϸ  ķ
+template<typename RandomIt, typename Compare>
+void SmallSort(RandomIt first, RandomIt last, Compare comp)
 {
-	priority_queue<int, vector<int>, greater<int>> pq;
+	using T = typename std::iterator_traits<RandomIt>::value_type;
 
-	// O(NlogN)
-	for (int num : v)
+	if constexpr (SortingNetworkSupported<T, Compare>)
 	{
-		pq.push(num);
+		const ptrdiff_t n = last - first;
+		const bool descending = SortingNetworkDescending<T, Compare>;
+
+		if (n <= 1)
+		{
+			return;
+		}
+
+		if (n <= 8)
+		{
+			SortingNetworkPadded<8>(first, n, descending);
+			return;
+		}
+
+		if (n <= 16)
+		{
+			SortingNetworkPadded<16>(first, n, descending);
+			return;
+		}
+
+		if (n <= 32)
+		{
+			SortingNetworkPadded<32>(first, n, descending);
+			return;
+		}
+
+		if (n <= 64)
+		{
+			SortingNetworkPadded<64>(first, n, descending);
+			return;
+		}
 	}
 
-	v.clear();
+	InsertionSort(first, last, comp);
+}
+
+// ̺      .
+constexpr ptrdiff_t InsertionSortThreshold = 16;
+
+// ̺    ,     ʰ SmallSort .
+template<typename T, typename Compare>
+constexpr ptrdiff_t SmallSortThreshold = SortingNetworkSupported<T, Compare> ? SortingNetworkMaxSize : InsertionSortThreshold;
+
+//  
+//  ü   (O(N)) ⸦ ϳ ڷ . (O(NlogN))
+// ߰ ޸𸮰 ʿ  Ʈ , PdqSort ġģ     .
+//   Ʒ     δ.
+template<typename RandomIt, typename Compare = std::less<>>
+void HeapSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+	//  ڿ ;   ⿡  
+	MakeHeap(first, last, comp);
 
-	// O(NlogN)
-	while (pq.empty() == false)
+	for (RandomIt end = last; end - first > 1; --end)
 	{
-		v.push_back(pq.top());
-		pq.pop();
+		PopHeap(first, end, comp);
 	}
 }
 
+template<typename Container, typename Compare = std::less<>>
+auto HeapSort(Container& v, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	HeapSort(v.data(), v.data() + v.size(), comp);
+}
+
 //  
 //   (Divide and Conquer)
 // -  (Divide)	  ܼϰ Ѵ.
@@ -100,105 +319,2000 @@ void HeapSort(vector<int>& v)
 // -  (Combine)	 Ͽ 
 
 // O(NlogN)
-void MergeResult(vector<int>& v, int left, int mid, int right)
+// [first, mid) [mid, last) Ѵ.
+//   buffer Űܵΰ տ ä. buffer (mid - first)ĭ ̻̾ Ѵ.
+template<typename RandomIt, typename BufferIt, typename Compare>
+void MergeResult(RandomIt first, RandomIt mid, RandomIt last, BufferIt buffer, Compare comp)
 {
-	int leftIdx = left;
-	int rightIdx = mid + 1;
+	BufferIt leftIt = buffer;
+	BufferIt leftEnd = std::move(first, mid, buffer);
+	RandomIt rightIt = mid;
+	RandomIt dest = first;
 
-	vector<int> temp;
-
-	while (leftIdx <= mid && rightIdx <= right)
+	while (leftIt != leftEnd && rightIt != last)
 	{
-		if (v[leftIdx] <= v[rightIdx])
+		//    ( )
+		if (comp(*rightIt, *leftIt) == false)
 		{
-			temp.push_back(v[leftIdx]);
-			leftIdx++;
+			*dest = std::move(*leftIt);
+			++leftIt;
 		}
 		else
 		{
-			temp.push_back(v[rightIdx]);
-			rightIdx++;
+			*dest = std::move(*rightIt);
+			++rightIt;
+		}
+
+		++dest;
+	}
+
+	//   ̹ ڸ ִ.
+	std::move(leftIt, leftEnd, dest);
+}
+
+template<typename RandomIt, typename BufferIt, typename Compare>
+void MergeSortLoop(RandomIt first, RandomIt last, BufferIt buffer, Compare comp)
+{
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+
+	//     Ƿ   ƴ  Ʈũ   .
+	if constexpr (std::is_integral_v<T> && SortingNetworkSupported<T, Compare>)
+	{
+		if (last - first <= SmallSortThreshold<T, Compare>)
+		{
+			SmallSort(first, last, comp);
+			return;
 		}
 	}
 
-	if (leftIdx > mid)
+	if (last - first <= 1)
+	{
+		return;
+	}
+
+	RandomIt mid = first + (last - first) / 2;
+	MergeSortLoop(first, mid, buffer, comp);
+	MergeSortLoop(mid, last, buffer, comp);
+
+	MergeResult(first, mid, last, buffer, comp);
+}
+
+// buffer ȣϴ  غ ۾ . ڶ ø.
+//  buffer   ϸ Ҵ Ͼ ʴ´.
+template<typename RandomIt, typename Compare>
+void MergeSort(RandomIt first, RandomIt last, Compare comp,
+	vector<typename std::iterator_traits<RandomIt>::value_type>& buffer)
+{
+	const size_t n = static_cast<size_t>(last - first);
+
+	if (buffer.size() < n / 2)
+	{
+		buffer.resize(n / 2);
+	}
+
+	MergeSortLoop(first, last, buffer.begin(), comp);
+}
+
+template<typename RandomIt, typename Compare = std::less<>>
+void MergeSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+	vector<typename std::iterator_traits<RandomIt>::value_type> buffer;
+	MergeSort(first, last, comp, buffer);
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto MergeSort(Container& v, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	MergeSort(v.data(), v.data() + v.size(), comp);
+}
+
+// [left, right]  (  )
+template<typename Container>
+auto MergeSort(Container& v, ptrdiff_t left, ptrdiff_t right) -> decltype(v.data(), void())
+{
+	if (left >= right)
+	{
+		return;
+	}
+
+	MergeSort(v.data() + left, v.data() + right + 1);
+}
+
+//   (TimSort)
+// Ʒ  (bottom-up) ϴ ݺ  .
+// -  (run) : ̹  (Ǵ   )  ã ״ .
+//              ª  ּ ̱   ķ ø.
+// -   : ̰   յǵ    Ѵ.
+// -  (galloping) :        Ž Ѳ ű.
+// ĵ Է̳  ĵ Է O(N) , ־ O(NlogN).  .
+// ۾  ó N/2 ĭ   ´.
+
+constexpr ptrdiff_t TimSortMinMerge = 32;
+constexpr ptrdiff_t TimSortMinGallop = 7;
+
+//  ּ . n / minRun  2 ŵ  .
+inline ptrdiff_t TimSortMinRun(ptrdiff_t n)
+{
+	ptrdiff_t r = 0;
+
+	while (n >= TimSortMinMerge)
+	{
+		r |= n & 1;
+		n >>= 1;
+	}
+
+	return n + r;
+}
+
+// [first, last) տ ϴ  .  ̸   .
+// (      Ƿ  츸)
+template<typename RandomIt, typename Compare>
+ptrdiff_t CountRunAndMakeAscending(RandomIt first, RandomIt last, Compare comp)
+{
+	RandomIt run = first + 1;
+
+	if (run == last)
+	{
+		return 1;
+	}
+
+	if (comp(*run, *first))
 	{
-		while (rightIdx <= right)
+		while (++run != last && comp(*run, *(run - 1)))
 		{
-			temp.push_back(v[rightIdx]);
-			rightIdx++;
 		}
+
+		std::reverse(first, run);
 	}
 	else
 	{
-		while (leftIdx <= mid)
+		while (++run != last && comp(*run, *(run - 1)) == false)
 		{
-			temp.push_back(v[leftIdx]);
-			leftIdx++;
 		}
 	}
 
-	for (int i = 0; i < temp.size(); i++)
+	return run - first;
+}
+
+// [first, start) ĵǾ ִ. [start, last) ϳ  Ž ڸ ִ´.
+template<typename RandomIt, typename Compare>
+void BinaryInsertionSort(RandomIt first, RandomIt last, RandomIt start, Compare comp)
+{
+	for (; start != last; ++start)
 	{
-		v[left + i] = temp[i];
+		//   ڿ ־  
+		RandomIt pos = std::upper_bound(first, start, *start, comp);
+		auto insertData = std::move(*start);
+		std::move_backward(pos, start, start + 1);
+		*pos = std::move(insertData);
 	}
 }
 
-void MergeSort(vector<int>& v, int left, int right)
+// ĵ  pred ó false Ǵ ġ (std::partition_point)
+//  (fromEnd == false) Ǵ ڿ 1, 2, 4, ... ĭ ǳʶٸ     ŽѴ.
+//   ʿ kĭ   O(logk)
+template<typename RandomIt, typename Pred>
+RandomIt GallopSearch(RandomIt first, RandomIt last, bool fromEnd, Pred pred)
 {
-	if (left >= right)
+	using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+	const Diff n = last - first;
+	Diff step = 1;
+
+	if (fromEnd == false)
+	{
+		// [0, low)  pred true
+		Diff low = 0;
+		while (low + step <= n && pred(first[low + step - 1]))
+		{
+			low += step;
+			step *= 2;
+		}
+
+		return std::partition_point(first + low, first + std::min(low + step - 1, n), pred);
+	}
+
+	// [high, n)  pred false
+	Diff high = n;
+	while (high - step >= 0 && pred(first[high - step]) == false)
+	{
+		high -= step;
+		step *= 2;
+	}
+
+	return std::partition_point(first + std::max<Diff>(high - step + 1, 0), first + high, pred);
+}
+
+// [first, mid) [mid, last) Ѵ. ª ʸ buffer ű.
+// minGallop  ̿ ̾   . ְ  ϸ  ƴϸ .
+template<typename RandomIt, typename BufferIt, typename Compare>
+void MergeRuns(RandomIt first, RandomIt mid, RandomIt last, BufferIt buffer, ptrdiff_t& minGallop, Compare comp)
+{
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+
+	//     ù  ũ  պκ,         ޺κ
+	// ̹ ڸ ִ.
+	first = GallopSearch(first, mid, false, [&](const T& x) { return comp(*mid, x) == false; });
+	if (first == mid)
+	{
+		return;
+	}
+
+	last = GallopSearch(mid, last, true, [&](const T& x) { return comp(x, *(mid - 1)); });
+	if (mid == last)
 	{
 		return;
 	}
 
-	int mid = (left + right) / 2;
-	MergeSort(v, left, mid);
-	MergeSort(v, mid + 1, right);
+	ptrdiff_t count1 = 0; //     
+	ptrdiff_t count2 = 0; //     
+
+	if (mid - first <= last - mid)
+	{
+		//  buffer ű տ ä.
+		// ׻ dest + (  ) == right
+		BufferIt left = buffer;
+		BufferIt leftEnd = std::move(first, mid, buffer);
+		RandomIt right = mid;
+		RandomIt dest = first;
+
+		while (left != leftEnd && right != last)
+		{
+			// ϳ 
+			count1 = 0;
+			count2 = 0;
+
+			while (left != leftEnd && right != last && count1 < minGallop && count2 < minGallop)
+			{
+				if (comp(*right, *left))
+				{
+					*dest++ = std::move(*right++);
+					count2++;
+					count1 = 0;
+				}
+				else
+				{
+					*dest++ = std::move(*left++);
+					count1++;
+					count2 = 0;
+				}
+			}
+
+			// 
+			while (left != leftEnd && right != last)
+			{
+				BufferIt leftStop = GallopSearch(left, leftEnd, false, [&](const T& x) { return comp(*right, x) == false; });
+				count1 = leftStop - left;
+				dest = std::move(left, leftStop, dest);
+				left = leftStop;
+
+				if (left == leftEnd)
+				{
+					break;
+				}
+
+				*dest++ = std::move(*right++);
+
+				if (right == last)
+				{
+					break;
+				}
+
+				RandomIt rightStop = GallopSearch(right, last, false, [&](const T& x) { return comp(x, *left); });
+				count2 = rightStop - right;
+				dest = std::move(right, rightStop, dest);
+				right = rightStop;
+
+				if (right == last)
+				{
+					break;
+				}
+
+				*dest++ = std::move(*left++);
+
+				if (count1 < TimSortMinGallop && count2 < TimSortMinGallop)
+				{
+					minGallop += 2;
+					break;
+				}
+
+				minGallop = std::max<ptrdiff_t>(minGallop - 1, 1);
+			}
+		}
+
+		std::move(left, leftEnd, dest);
+	}
+	else
+	{
+		//  buffer ű ڿ ä.  ̸   (ڿ) ´.
+		// ׻ dest - (  ) == left
+		BufferIt right = std::move(mid, last, buffer);
+		RandomIt left = mid;
+		RandomIt dest = last;
+
+		while (left != first && right != buffer)
+		{
+			count1 = 0;
+			count2 = 0;
+
+			while (left != first && right != buffer && count1 < minGallop && count2 < minGallop)
+			{
+				if (comp(*(right - 1), *(left - 1)))
+				{
+					*--dest = std::move(*--left);
+					count1++;
+					count2 = 0;
+				}
+				else
+				{
+					*--dest = std::move(*--right);
+					count2++;
+					count1 = 0;
+				}
+			}
+
+			while (left != first && right != buffer)
+			{
+				RandomIt leftStop = GallopSearch(first, left, true, [&](const T& x) { return comp(*(right - 1), x) == false; });
+				count1 = left - leftStop;
+				dest = std::move_backward(leftStop, left, dest);
+				left = leftStop;
+
+				if (left == first)
+				{
+					break;
+				}
+
+				*--dest = std::move(*--right);
 
-	MergeResult(v, left, mid, right);
+				if (right == buffer)
+				{
+					break;
+				}
+
+				BufferIt rightStop = GallopSearch(buffer, right, true, [&](const T& x) { return comp(x, *(left - 1)); });
+				count2 = right - rightStop;
+				dest = std::move_backward(rightStop, right, dest);
+				right = rightStop;
+
+				if (right == buffer)
+				{
+					break;
+				}
+
+				*--dest = std::move(*--left);
+
+				if (count1 < TimSortMinGallop && count2 < TimSortMinGallop)
+				{
+					minGallop += 2;
+					break;
+				}
+
+				minGallop = std::max<ptrdiff_t>(minGallop - 1, 1);
+			}
+		}
+
+		std::move_backward(buffer, right, dest);
+	}
 }
 
-// high, low   ̵ϰų ڷ ̵ ̰
-// high, low ٽ ʱⰪ ư ݺ ° ƴϱ  O(N)̴.
-// O(N)
-int Partition(vector<int>& v, int left, int right)
+// buffer ȣϴ  غ ۾ . ڶ ø.
+template<typename RandomIt, typename Compare>
+void TimSort(RandomIt first, RandomIt last, Compare comp,
+	vector<typename std::iterator_traits<RandomIt>::value_type>& buffer)
 {
-	int pivot = v[left];
-	int low = left + 1;
-	int high = right;
+	const ptrdiff_t n = last - first;
+
+	if (n <= 1)
+	{
+		return;
+	}
 
-	while (low <= high)
+	// ª  ϳ   ķ .
+	if (n < TimSortMinMerge)
 	{
-		while (low <= right && pivot >= v[low])
+		ptrdiff_t runLength = CountRunAndMakeAscending(first, last, comp);
+		BinaryInsertionSort(first, last, first + runLength, comp);
+		return;
+	}
+
+	if (buffer.size() < static_cast<size_t>(n / 2))
+	{
+		buffer.resize(n / 2);
+	}
+
+	const ptrdiff_t minRun = TimSortMinRun(n);
+	ptrdiff_t minGallop = TimSortMinGallop;
+
+	// ( ġ, )
+	// ̰ Ǻġ   þǷ  100ĭ  ʴ´.
+	vector<pair<ptrdiff_t, ptrdiff_t>> runs;
+	runs.reserve(100);
+
+	auto mergeAt = [&](size_t i)
+	{
+		RandomIt base = first + runs[i].first;
+		RandomIt mid = base + runs[i].second;
+		RandomIt end = mid + runs[i + 1].second;
+
+		runs[i].second += runs[i + 1].second;
+		runs.erase(runs.begin() + i + 1);
+
+		MergeRuns(base, mid, end, buffer.begin(), minGallop, comp);
+	};
+
+	ptrdiff_t start = 0;
+
+	while (start < n)
+	{
+		ptrdiff_t runLength = CountRunAndMakeAscending(first + start, last, comp);
+
+		if (runLength < minRun)
 		{
-			low++;
+			ptrdiff_t forced = std::min(minRun, n - start);
+			BinaryInsertionSort(first + start, first + start + forced, first + start + runLength, comp);
+			runLength = forced;
 		}
 
-		while (high >= left + 1 && pivot <= v[high])
+		runs.push_back({ start, runLength });
+		start += runLength;
+
+		//     A, B, C (C  )  A > B + C, B > C  Ѵ.
+		while (runs.size() > 1)
 		{
-			high--;
+			size_t i = runs.size() - 2;
+
+			if ((i > 0 && runs[i - 1].second <= runs[i].second + runs[i + 1].second)
+				|| (i > 1 && runs[i - 2].second <= runs[i - 1].second + runs[i].second))
+			{
+				if (runs[i - 1].second < runs[i + 1].second)
+				{
+					i--;
+				}
+			}
+			else if (runs[i].second > runs[i + 1].second)
+			{
+				break;
+			}
+
+			mergeAt(i);
 		}
+	}
+
+	while (runs.size() > 1)
+	{
+		size_t i = runs.size() - 2;
 
-		if (low < high)
+		if (i > 0 && runs[i - 1].second < runs[i + 1].second)
 		{
-			swap(v[low], v[high]);
+			i--;
 		}
+
+		mergeAt(i);
 	}
+}
 
-	swap(v[left], v[high]);
-	return high;
+template<typename RandomIt, typename Compare = std::less<>>
+void TimSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+	vector<typename std::iterator_traits<RandomIt>::value_type> buffer;
+	TimSort(first, last, comp, buffer);
 }
 
-// ־ : O(N^2)
-//  : O(NlogN)
-void QuickSort(vector<int>& v, int left, int right)
+template<typename Container, typename Compare = std::less<>>
+auto TimSort(Container& v, Compare comp = Compare()) -> decltype(v.data(), void())
 {
-	if (left > right)
+	TimSort(v.data(), v.data() + v.size(), comp);
+}
+
+//  n log2 ()
+inline int Log2(size_t n)
+{
+	int log = 0;
+
+	while (n > 1)
 	{
-		return;
+		n >>= 1;
+		log++;
+	}
+
+	return log;
+}
+
+// a, b, c  ߰ ġ
+template<typename RandomIt, typename Compare>
+RandomIt MedianOfThree(RandomIt a, RandomIt b, RandomIt c, Compare comp)
+{
+	if (comp(*a, *b))
+	{
+		if (comp(*b, *c))
+		{
+			return b;
+		}
+
+		return comp(*a, *c) ? c : a;
 	}
 
-	int pivot = Partition(v, left, right);
-	QuickSort(v, left, pivot - 1);
-	QuickSort(v, pivot + 1, right);
-}
\ No newline at end of file
+	if (comp(*a, *c))
+	{
+		return a;
+	}
+
+	return comp(*b, *c) ? c : b;
+}
+
+// ǹ     ű.
+//    °, ,  ߰ (median-of-three)
+//   ĺ   Է¿   ִ밪  Ű   ġ ʴ´.
+// ū     ߰   ٽ  ߰ (ninther)
+// ĵ Է̳  Է¿   ǹ .
+template<typename RandomIt, typename Compare>
+void ChoosePivot(RandomIt first, RandomIt last, Compare comp)
+{
+	const auto n = last - first;
+	RandomIt mid = first + n / 2;
+	RandomIt median;
+
+	if (n > 128)
+	{
+		const auto s = n / 8;
+		RandomIt m1 = MedianOfThree(first + 1, first + 1 + s, first + 1 + 2 * s, comp);
+		RandomIt m2 = MedianOfThree(mid - s, mid, mid + s, comp);
+		RandomIt m3 = MedianOfThree(last - 1 - 2 * s, last - 1 - s, last - 1, comp);
+		median = MedianOfThree(m1, m2, m3, comp);
+	}
+	else
+	{
+		median = MedianOfThree(first + 1, mid, last - 1, comp);
+	}
+
+	std::iter_swap(first, median);
+}
+
+// high, low   ̵ϰų ڷ ̵ ̰
+// high, low ٽ ʱⰪ ư ݺ ° ƴϱ  O(N)̴.
+// O(N)
+//    ǹ .
+// ǹ     ȯϹǷ   Ƶ   .
+// ȯ : ǹ  ġ
+template<typename RandomIt, typename Compare>
+RandomIt Partition(RandomIt first, RandomIt last, Compare comp)
+{
+	using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+
+	const Diff n = last - first;
+	const auto& pivot = *first;
+	Diff low = 0;
+	Diff high = n;
+
+	while (true)
+	{
+		do
+		{
+			low++;
+		} while (low < n && comp(first[low], pivot));
+
+		// first[0] ǹ̹Ƿ high 0 ݵ .
+		do
+		{
+			high--;
+		} while (comp(pivot, first[high]));
+
+		if (low >= high)
+		{
+			break;
+		}
+
+		std::iter_swap(first + low, first + high);
+	}
+
+	std::iter_swap(first, first + high);
+	return first + high;
+}
+
+template<typename RandomIt, typename Compare>
+void IntroSortLoop(RandomIt first, RandomIt last, int depthLimit, Compare comp)
+{
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+
+	while (last - first > SmallSortThreshold<T, Compare>)
+	{
+		//    ġġ  ķ ٲ O(NlogN) Ѵ.
+		if (depthLimit == 0)
+		{
+			HeapSort(first, last, comp);
+			return;
+		}
+
+		depthLimit--;
+
+		ChoosePivot(first, last, comp);
+		RandomIt pivot = Partition(first, last, comp);
+
+		//  ʸ ϰ ū  ݺ ó  ̸ O(logN) Ѵ.
+		if (pivot - first < last - (pivot + 1))
+		{
+			IntroSortLoop(first, pivot, depthLimit, comp);
+			first = pivot + 1;
+		}
+		else
+		{
+			IntroSortLoop(pivot + 1, last, depthLimit, comp);
+			last = pivot;
+		}
+	}
+
+	SmallSort(first, last, comp);
+}
+
+// Ʈ  (Introsort)
+//   +  ̰ 2logN    +    
+// ־ : O(NlogN)
+//  : O(NlogN)
+template<typename RandomIt, typename Compare = std::less<>>
+void QuickSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+	if (last - first <= 1)
+	{
+		return;
+	}
+
+	IntroSortLoop(first, last, 2 * Log2(static_cast<size_t>(last - first)), comp);
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto QuickSort(Container& v, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	QuickSort(v.data(), v.data() + v.size(), comp);
+}
+
+// [left, right]  (  )
+template<typename Container>
+auto QuickSort(Container& v, ptrdiff_t left, ptrdiff_t right) -> decltype(v.data(), void())
+{
+	if (left >= right)
+	{
+		return;
+	}
+
+	QuickSort(v.data() + left, v.data() + right + 1);
+}
+
+//     (Pattern-defeating Quicksort)
+// Ʈ Ŀ   .
+// -   :   б   迭   Ѳ ȯѴ.
+//                Է¿ б  а .
+// - ̹  ִ  : ȯ    κ  ķ ٷ  .
+//                           ĵ Է,  Է O(N)
+// -   : ǹ ٷ            ǳʶڴ.
+// - ġģ  : Ҹ   , logN   ķ ٲ۴.
+// ־ : O(NlogN)
+
+constexpr ptrdiff_t PdqBlockSize = 64;
+constexpr ptrdiff_t PdqPartialInsertionLimit = 8;
+
+//  ϴٰ ű   PdqPartialInsertionLimit  ߴѴ.
+//   true.
+template<typename RandomIt, typename Compare>
+bool PartialInsertionSort(RandomIt first, RandomIt last, Compare comp)
+{
+	using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+
+	if (first == last)
+	{
+		return true;
+	}
+
+	Diff moved = 0;
+
+	for (RandomIt cur = first + 1; cur != last; ++cur)
+	{
+		RandomIt sift = cur;
+		RandomIt siftPrev = cur - 1;
+
+		if (comp(*sift, *siftPrev))
+		{
+			auto insertData = std::move(*sift);
+
+			do
+			{
+				*sift-- = std::move(*siftPrev);
+			} while (sift != first && comp(insertData, *--siftPrev));
+
+			*sift = std::move(insertData);
+			moved += cur - sift;
+		}
+
+		if (moved > PdqPartialInsertionLimit)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//   offsetsLeft[i]°   offsetsRight[i]° ¹ٲ۴.
+// ȯ   ϳ  ȯŰ ̵ Ƚ 3N -> N+1  پ.
+// ,     ȯ  Է¿ O(N^2)   ־ ȯ Ѵ.
+template<typename RandomIt>
+void SwapOffsets(RandomIt leftBase, RandomIt rightBase,
+	const unsigned char* offsetsLeft, const unsigned char* offsetsRight, ptrdiff_t count, bool useSwaps)
+{
+	if (useSwaps)
+	{
+		for (ptrdiff_t i = 0; i < count; i++)
+		{
+			std::iter_swap(leftBase + offsetsLeft[i], rightBase - offsetsRight[i]);
+		}
+	}
+	else if (count > 0)
+	{
+		RandomIt l = leftBase + offsetsLeft[0];
+		RandomIt r = rightBase - offsetsRight[0];
+		auto temp = std::move(*l);
+		*l = std::move(*r);
+
+		for (ptrdiff_t i = 1; i < count; i++)
+		{
+			l = leftBase + offsetsLeft[i];
+			*r = std::move(*l);
+			r = rightBase - offsetsRight[i];
+			*l = std::move(*r);
+		}
+
+		*r = std::move(temp);
+	}
+}
+
+//  
+//    ǹ [ǹ  ][ǹ][ǹ ̻]  .
+// ȯ : (ǹ ġ,   ̹  ־)
+template<typename RandomIt, typename Compare>
+std::pair<RandomIt, bool> PartitionRightBranchless(RandomIt begin, RandomIt end, Compare comp)
+{
+	using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+
+	auto pivot = std::move(*begin);
+	RandomIt first = begin;
+	RandomIt last = end;
+
+	// ǹ ̻ ù  (ǹ  Ļ ݵ )
+	while (comp(*++first, pivot));
+
+	// ǹ   . ʿ  Ұ ٸ  ˻ؾ Ѵ.
+	if (first - 1 == begin)
+	{
+		while (first < last && comp(*--last, pivot) == false);
+	}
+	else
+	{
+		while (comp(*--last, pivot) == false);
+	}
+
+	bool alreadyPartitioned = first >= last;
+
+	if (alreadyPartitioned == false)
+	{
+		std::iter_swap(first, last);
+		++first;
+
+		unsigned char offsetsLeft[PdqBlockSize];
+		unsigned char offsetsRight[PdqBlockSize];
+		RandomIt leftBase = first;
+		RandomIt rightBase = last;
+		Diff numLeft = 0;
+		Diff numRight = 0;
+		Diff startLeft = 0;
+		Diff startRight = 0;
+
+		while (first < last)
+		{
+			//  ĭ  Ͽ ش. ʿ  ȯ Ұ    ä ʴ´.
+			Diff unknown = last - first;
+			Diff leftSplit = numLeft == 0 ? (numRight == 0 ? unknown / 2 : unknown) : 0;
+			Diff rightSplit = numRight == 0 ? (unknown - leftSplit) : 0;
+
+			// б  'ڸ ߸ '  ¸ Ѵ.
+			Diff leftCount = std::min(leftSplit, PdqBlockSize);
+			for (Diff i = 0; i < leftCount; i++)
+			{
+				offsetsLeft[numLeft] = static_cast<unsigned char>(i);
+				numLeft += comp(*first, pivot) == false;
+				++first;
+			}
+
+			Diff rightCount = std::min(rightSplit, PdqBlockSize);
+			for (Diff i = 0; i < rightCount;)
+			{
+				offsetsRight[numRight] = static_cast<unsigned char>(++i);
+				numRight += comp(*--last, pivot);
+			}
+
+			Diff count = std::min(numLeft, numRight);
+			SwapOffsets(leftBase, rightBase, offsetsLeft + startLeft, offsetsRight + startRight, count, numLeft == numRight);
+
+			numLeft -= count;
+			numRight -= count;
+			startLeft += count;
+			startRight += count;
+
+			if (numLeft == 0)
+			{
+				startLeft = 0;
+				leftBase = first;
+			}
+
+			if (numRight == 0)
+			{
+				startRight = 0;
+				rightBase = last;
+			}
+		}
+
+		//  Ͽ  Ҹ   ش.
+		if (numLeft)
+		{
+			const unsigned char* offsets = offsetsLeft + startLeft;
+			while (numLeft--)
+			{
+				std::iter_swap(leftBase + offsets[numLeft], --last);
+			}
+
+			first = last;
+		}
+
+		if (numRight)
+		{
+			const unsigned char* offsets = offsetsRight + startRight;
+			while (numRight--)
+			{
+				std::iter_swap(rightBase - offsets[numRight], first);
+				++first;
+			}
+
+			last = first;
+		}
+	}
+
+	RandomIt pivotPos = first - 1;
+	*begin = std::move(*pivotPos);
+	*pivotPos = std::move(pivot);
+
+	return std::make_pair(pivotPos, alreadyPartitioned);
+}
+
+//    ǹ [ǹ ][ǹ][ǹ ū ]  .
+// ǹ     ̹Ƿ   ٽ  ʿ䰡 .
+template<typename RandomIt, typename Compare>
+RandomIt PartitionLeft(RandomIt begin, RandomIt end, Compare comp)
+{
+	auto pivot = std::move(*begin);
+	RandomIt first = begin;
+	RandomIt last = end;
+
+	while (comp(pivot, *--last));
+
+	if (last + 1 == end)
+	{
+		while (first < last && comp(pivot, *++first) == false);
+	}
+	else
+	{
+		while (comp(pivot, *++first) == false);
+	}
+
+	while (first < last)
+	{
+		std::iter_swap(first, last);
+		while (comp(pivot, *--last));
+		while (comp(pivot, *++first) == false);
+	}
+
+	RandomIt pivotPos = last;
+	*begin = std::move(*pivotPos);
+	*pivotPos = std::move(pivot);
+
+	return pivotPos;
+}
+
+// leftmost false *(begin - 1)   ǹ̸    ۰ų .
+template<typename RandomIt, typename Compare>
+void PdqSortLoop(RandomIt begin, RandomIt end, Compare comp, int badAllowed, bool leftmost)
+{
+	using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+
+	while (true)
+	{
+		Diff size = end - begin;
+
+		if (size <= SmallSortThreshold<T, Compare>)
+		{
+			SmallSort(begin, end, comp);
+			return;
+		}
+
+		ChoosePivot(begin, end, comp);
+
+		// ǹ   ǹ ٸ  ǹ   .
+		//   ʿ  ʸ  Ѵ.
+		if (leftmost == false && comp(*(begin - 1), *begin) == false)
+		{
+			begin = PartitionLeft(begin, end, comp) + 1;
+			continue;
+		}
+
+		std::pair<RandomIt, bool> result = PartitionRightBranchless(begin, end, comp);
+		RandomIt pivotPos = result.first;
+		bool alreadyPartitioned = result.second;
+
+		Diff leftSize = pivotPos - begin;
+		Diff rightSize = end - (pivotPos + 1);
+		bool highlyUnbalanced = leftSize < size / 8 || rightSize < size / 8;
+
+		if (highlyUnbalanced)
+		{
+			if (--badAllowed == 0)
+			{
+				HeapSort(begin, end, comp);
+				return;
+			}
+
+			//   Ҹ   ǹ   Ͽ ɸ ʰ Ѵ.
+			if (leftSize >= InsertionSortThreshold)
+			{
+				std::iter_swap(begin, begin + leftSize / 4);
+				std::iter_swap(pivotPos - 1, pivotPos - leftSize / 4);
+
+				if (leftSize > 128)
+				{
+					std::iter_swap(begin + 1, begin + (leftSize / 4 + 1));
+					std::iter_swap(begin + 2, begin + (leftSize / 4 + 2));
+					std::iter_swap(pivotPos - 2, pivotPos - (leftSize / 4 + 1));
+					std::iter_swap(pivotPos - 3, pivotPos - (leftSize / 4 + 2));
+				}
+			}
+
+			if (rightSize >= InsertionSortThreshold)
+			{
+				std::iter_swap(pivotPos + 1, pivotPos + (1 + rightSize / 4));
+				std::iter_swap(end - 1, end - rightSize / 4);
+
+				if (rightSize > 128)
+				{
+					std::iter_swap(pivotPos + 2, pivotPos + (2 + rightSize / 4));
+					std::iter_swap(pivotPos + 3, pivotPos + (3 + rightSize / 4));
+					std::iter_swap(end - 2, end - (1 + rightSize / 4));
+					std::iter_swap(end - 3, end - (2 + rightSize / 4));
+				}
+			}
+		}
+		else if (alreadyPartitioned
+			&& PartialInsertionSort(begin, pivotPos, comp)
+			&& PartialInsertionSort(pivotPos + 1, end, comp))
+		{
+			return;
+		}
+
+		PdqSortLoop(begin, pivotPos, comp, badAllowed, leftmost);
+		begin = pivotPos + 1;
+		leftmost = false;
+	}
+}
+
+template<typename RandomIt, typename Compare = std::less<>>
+void PdqSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+	if (last - first <= 1)
+	{
+		return;
+	}
+
+	PdqSortLoop(first, last, comp, Log2(static_cast<size_t>(last - first)), true);
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto PdqSort(Container& v, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	PdqSort(v.data(), v.data() + v.size(), comp);
+}
+
+//  
+// ThreadPool ۾ ġ    óѴ.
+//  ParallelSortGrain ۾   ʰ  忡 Ѵ.
+
+constexpr ptrdiff_t ParallelSortGrain = 1 << 14;
+
+// 帶 ۾   ư ߰  ʹ ۰Դ  ʴ´.
+inline ptrdiff_t ParallelSortGrainSize(ptrdiff_t n, unsigned threadCount)
+{
+	return std::max<ptrdiff_t>(ParallelSortGrain, n / (static_cast<ptrdiff_t>(threadCount) * 8));
+}
+
+//   (co-rank)
+// [first1, first1 + n1) [first2, first2 + n2)     k  ù    
+// ù  i   first1[i] first2[k - i - 1] տ ; ϸ i ڶ ̰,
+// i Ŀ ׷ ʰ ǹǷ  ŽѴ. O(log(min(k, n1 + n2 - k)))
+template<typename InputIt1, typename InputIt2, typename Compare>
+ptrdiff_t CoRank(ptrdiff_t k, InputIt1 first1, ptrdiff_t n1, InputIt2 first2, ptrdiff_t n2, Compare comp)
+{
+	ptrdiff_t low = std::max<ptrdiff_t>(0, k - n2);
+	ptrdiff_t high = std::min(k, n1);
+
+	while (low < high)
+	{
+		ptrdiff_t i = low + (high - low) / 2;
+		ptrdiff_t j = k - i;
+
+		//  ù   ( )
+		if (j > 0 && comp(first2[j - 1], first1[i]) == false)
+		{
+			low = i + 1;
+		}
+		else
+		{
+			high = i;
+		}
+	}
+
+	return low;
+}
+
+// [first1, last1) [first2, last2) dest Ѵ.
+//  grain ũ      Է ,     Ѵ.
+template<typename InputIt1, typename InputIt2, typename OutputIt, typename Compare>
+void ParallelMerge(ThreadPool& pool, InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+	OutputIt dest, Compare comp, ptrdiff_t grain)
+{
+	const ptrdiff_t n1 = last1 - first1;
+	const ptrdiff_t n2 = last2 - first2;
+	const ptrdiff_t total = n1 + n2;
+	const ptrdiff_t parts = std::max<ptrdiff_t>(1, total / grain);
+
+	auto mergePart = [=, &comp](ptrdiff_t part)
+	{
+		ptrdiff_t k0 = total * part / parts;
+		ptrdiff_t k1 = total * (part + 1) / parts;
+		ptrdiff_t i0 = CoRank(k0, first1, n1, first2, n2, comp);
+		ptrdiff_t i1 = CoRank(k1, first1, n1, first2, n2, comp);
+
+		std::merge(std::make_move_iterator(first1 + i0), std::make_move_iterator(first1 + i1),
+			std::make_move_iterator(first2 + (k0 - i0)), std::make_move_iterator(first2 + (k1 - i1)),
+			dest + k0, comp);
+	};
+
+	TaskGroup group(pool);
+
+	for (ptrdiff_t part = 1; part < parts; part++)
+	{
+		group.run([&mergePart, part]() { mergePart(part); });
+	}
+
+	mergePart(0);
+	group.wait();
+}
+
+// toBuffer   buffer, ƴϸ [first, last) д.
+//   ݴ 迭  ΰ ϸ鼭 ϴ  űǷ ǵ ϴ ܰ谡 .
+template<typename RandomIt, typename BufferIt, typename Compare>
+void ParallelMergeSortLoop(ThreadPool& pool, RandomIt first, RandomIt last, BufferIt buffer, bool toBuffer,
+	Compare comp, ptrdiff_t grain)
+{
+	const ptrdiff_t n = last - first;
+
+	if (n <= grain)
+	{
+		MergeSortLoop(first, last, buffer, comp);
+
+		if (toBuffer)
+		{
+			std::move(first, last, buffer);
+		}
+
+		return;
+	}
+
+	const ptrdiff_t half = n / 2;
+
+	{
+		TaskGroup group(pool);
+		group.run([&]() { ParallelMergeSortLoop(pool, first, first + half, buffer, toBuffer == false, comp, grain); });
+		ParallelMergeSortLoop(pool, first + half, last, buffer + half, toBuffer == false, comp, grain);
+		group.wait();
+	}
+
+	if (toBuffer)
+	{
+		ParallelMerge(pool, first, first + half, first + half, last, buffer, comp, grain);
+	}
+	else
+	{
+		ParallelMerge(pool, buffer, buffer + half, buffer + half, buffer + n, first, comp, grain);
+	}
+}
+
+//   
+//   ķ ϰ յ    ķ Ѵ.  .
+// ۾  Nĭ
+template<typename RandomIt, typename Compare = std::less<>>
+void ParallelMergeSort(ThreadPool& pool, RandomIt first, RandomIt last, Compare comp = Compare())
+{
+	const ptrdiff_t n = last - first;
+
+	if (n <= 1)
+	{
+		return;
+	}
+
+	vector<typename std::iterator_traits<RandomIt>::value_type> buffer(n);
+	ParallelMergeSortLoop(pool, first, last, buffer.begin(), false, comp, ParallelSortGrainSize(n, pool.size()));
+}
+
+template<typename RandomIt, typename Compare = std::less<>>
+void ParallelMergeSort(RandomIt first, RandomIt last, Compare comp = Compare(), unsigned threadCount = 0)
+{
+	ThreadPool pool(threadCount);
+	ParallelMergeSort(pool, first, last, comp);
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto ParallelMergeSort(Container& v, Compare comp = Compare(), unsigned threadCount = 0) -> decltype(v.data(), void())
+{
+	ParallelMergeSort(v.data(), v.data() + v.size(), comp, threadCount);
+}
+
+// [first, last) pred true , false   ķ . ȯ : 
+// 1) ϸ  .
+// 2) ü  ʿ ִ false ҿ ʿ ִ true Ҵ  Ƿ  ¦ ȯѴ.
+template<typename RandomIt, typename Pred>
+RandomIt ParallelPartition(ThreadPool& pool, RandomIt first, RandomIt last, Pred pred, size_t blocks, ptrdiff_t grain)
+{
+	const ptrdiff_t n = last - first;
+
+	vector<ptrdiff_t> bounds(blocks + 1);
+	vector<ptrdiff_t> middles(blocks);
+
+	for (size_t b = 0; b <= blocks; b++)
+	{
+		bounds[b] = n * static_cast<ptrdiff_t>(b) / static_cast<ptrdiff_t>(blocks);
+	}
+
+	{
+		TaskGroup group(pool);
+
+		for (size_t b = 0; b < blocks; b++)
+		{
+			group.run([&, b]()
+				{
+					middles[b] = std::partition(first + bounds[b], first + bounds[b + 1], pred) - first;
+				});
+		}
+
+		group.wait();
+	}
+
+	ptrdiff_t boundary = 0;
+	for (size_t b = 0; b < blocks; b++)
+	{
+		boundary += middles[b] - bounds[b];
+	}
+
+	// ߸  ҵ  [, )
+	vector<pair<ptrdiff_t, ptrdiff_t>> wrongLeft;
+	vector<pair<ptrdiff_t, ptrdiff_t>> wrongRight;
+
+	for (size_t b = 0; b < blocks; b++)
+	{
+		if (middles[b] < boundary && middles[b] < bounds[b + 1])
+		{
+			wrongLeft.push_back({ middles[b], std::min(bounds[b + 1], boundary) });
+		}
+
+		if (middles[b] > boundary && bounds[b] < middles[b])
+		{
+			wrongRight.push_back({ std::max(bounds[b], boundary), middles[b] });
+		}
+	}
+
+	//   Բ 󰡸     ߶ ȯѴ.
+	TaskGroup group(pool);
+	size_t l = 0;
+	size_t r = 0;
+
+	while (l < wrongLeft.size() && r < wrongRight.size())
+	{
+		ptrdiff_t length = std::min({ wrongLeft[l].second - wrongLeft[l].first,
+			wrongRight[r].second - wrongRight[r].first, grain });
+
+		RandomIt a = first + wrongLeft[l].first;
+		RandomIt b = first + wrongRight[r].first;
+		group.run([a, b, length]() { std::swap_ranges(a, a + length, b); });
+
+		wrongLeft[l].first += length;
+		wrongRight[r].first += length;
+
+		if (wrongLeft[l].first == wrongLeft[l].second)
+		{
+			l++;
+		}
+
+		if (wrongRight[r].first == wrongRight[r].second)
+		{
+			r++;
+		}
+	}
+
+	group.wait();
+
+	return first + boundary;
+}
+
+template<typename RandomIt, typename Compare>
+void ParallelQuickSortLoop(ThreadPool& pool, RandomIt first, RandomIt last, Compare comp, int badAllowed, ptrdiff_t grain)
+{
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+
+	while (true)
+	{
+		const ptrdiff_t n = last - first;
+
+		//  ̳ ġģ  ӵǴ   忡 Ѵ. (־ O(NlogN))
+		if (n <= grain || badAllowed == 0)
+		{
+			PdqSort(first, last, comp);
+			return;
+		}
+
+		ChoosePivot(first, last, comp);
+
+		const size_t blocks = std::min<size_t>(pool.size(), static_cast<size_t>(n / grain));
+		RandomIt pivotPos;
+
+		if (blocks >= 2)
+		{
+			// ǹ  ҿ ׷  ҷ   ǹ  ű.
+			const T& pivot = *first;
+			RandomIt middle = ParallelPartition(pool, first + 1, last, [&](const T& x) { return comp(x, pivot); }, blocks, grain);
+
+			// ǹ       ̴.     Ѳ ǳʶڴ.
+			if (middle == first + 1)
+			{
+				first = ParallelPartition(pool, first + 1, last, [&](const T& x) { return comp(pivot, x) == false; }, blocks, grain);
+				continue;
+			}
+
+			pivotPos = middle - 1;
+			std::iter_swap(first, pivotPos);
+		}
+		else
+		{
+			pivotPos = Partition(first, last, comp);
+		}
+
+		if (std::min(pivotPos - first, last - pivotPos) < n / 8)
+		{
+			badAllowed--;
+		}
+
+		TaskGroup group(pool);
+		group.run([&pool, first, pivotPos, comp, badAllowed, grain]()
+			{
+				ParallelQuickSortLoop(pool, first, pivotPos, comp, badAllowed, grain);
+			});
+
+		ParallelQuickSortLoop(pool, pivotPos + 1, last, comp, badAllowed, grain);
+		group.wait();
+		return;
+	}
+}
+
+//   
+// ū  ǹ   ü   ķ ϰ,     ۾ ѱ.
+//   PdqSort
+template<typename RandomIt, typename Compare = std::less<>>
+void ParallelQuickSort(ThreadPool& pool, RandomIt first, RandomIt last, Compare comp = Compare())
+{
+	const ptrdiff_t n = last - first;
+
+	if (n <= 1)
+	{
+		return;
+	}
+
+	ParallelQuickSortLoop(pool, first, last, comp, Log2(static_cast<size_t>(n)), ParallelSortGrainSize(n, pool.size()));
+}
+
+template<typename RandomIt, typename Compare = std::less<>>
+void ParallelQuickSort(RandomIt first, RandomIt last, Compare comp = Compare(), unsigned threadCount = 0)
+{
+	ThreadPool pool(threadCount);
+	ParallelQuickSort(pool, first, last, comp);
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto ParallelQuickSort(Container& v, Compare comp = Compare(), unsigned threadCount = 0) -> decltype(v.data(), void())
+{
+	ParallelQuickSort(v.data(), v.data() + v.size(), comp, threadCount);
+}
+
+//   (Radix Sort)
+//   ʰ  Ű ڸ (digit)   ´.
+// key ҿ  Ű  Լ (⺻  ü). ü Ű   ִ.
+// ȣ ִ Ű ȣ Ʈ  ȣ    .
+
+//  ü Ű .
+struct RadixIdentity
+{
+	template<typename T>
+	constexpr const T& operator()(const T& value) const noexcept
+	{
+		return value;
+	}
+};
+
+template<typename KeyFunc, typename T>
+using RadixKeyType = std::make_unsigned_t<std::decay_t<std::invoke_result_t<KeyFunc&, const T&>>>;
+
+template<typename Key>
+constexpr std::make_unsigned_t<Key> RadixKey(Key key)
+{
+	static_assert(std::is_integral_v<Key>, "radix sort needs an integer key");
+
+	using Unsigned = std::make_unsigned_t<Key>;
+
+	if constexpr (std::is_signed_v<Key>)
+	{
+		return static_cast<Unsigned>(key) ^ (Unsigned(1) << (sizeof(Key) * 8 - 1));
+	}
+	else
+	{
+		return key;
+	}
+}
+
+//   ĳ÷ ̸ ҷ´.  ʴ Ϸ ƹ͵  ʴ´.
+inline void RadixPrefetch(const void* address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address, 1);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	_mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#else
+	(void)address;
+#endif
+}
+
+//    Ұ  ڸ ̸ ҷ
+constexpr ptrdiff_t RadixPrefetchDistance = 16;
+
+// [first, last) shift ڸ ڿ  dest ű. offsets ں   ġ.
+template<typename InputIt, typename OutputIt, typename KeyFunc>
+void RadixScatter(InputIt first, InputIt last, OutputIt dest, size_t* offsets, unsigned shift, size_t mask, KeyFunc& key)
+{
+	const ptrdiff_t n = last - first;
+
+	for (ptrdiff_t i = 0; i < n; i++)
+	{
+		if (i + RadixPrefetchDistance < n)
+		{
+			size_t ahead = (RadixKey(key(first[i + RadixPrefetchDistance])) >> shift) & mask;
+			RadixPrefetch(&*(dest + offsets[ahead]));
+		}
+
+		size_t digit = (RadixKey(key(first[i])) >> shift) & mask;
+		dest[offsets[digit]++] = std::move(first[i]);
+	}
+}
+
+// LSD  
+//   ڸ  ڸ   ⸦ ݺѴ.
+// -   Ⱦ  ڸ  Ѳ .
+// -  Ұ   ڸ ǳʶڴ. (   64Ʈ Ű )
+// - ڸ ũ digitBits 8, 11, 16 . 0̸    .
+//   ڸ Ŭ Ƚ   迭 Ŀ ĳÿ з.
+// ۾  Nĭ, O(N * ڸ ).  .
+template<typename RandomIt, typename KeyFunc = RadixIdentity>
+void RadixSort(RandomIt first, RandomIt last, KeyFunc key = KeyFunc(), unsigned digitBits = 0)
+{
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+	using Key = RadixKeyType<KeyFunc, T>;
+
+	constexpr unsigned keyBits = sizeof(Key) * 8;
+	const ptrdiff_t n = last - first;
+
+	if (n <= 1)
+	{
+		return;
+	}
+
+	if (digitBits == 0)
+	{
+		digitBits = n < (1 << 16) ? 8 : 11;
+	}
+
+	digitBits = std::min(digitBits, std::min(keyBits, 16u));
+
+	const unsigned passes = (keyBits + digitBits - 1) / digitBits;
+	const size_t buckets = size_t(1) << digitBits;
+	const size_t mask = buckets - 1;
+
+	vector<size_t> counts(passes * buckets, 0);
+
+	for (RandomIt it = first; it != last; ++it)
+	{
+		Key k = RadixKey(key(*it));
+
+		for (unsigned pass = 0; pass < passes; pass++)
+		{
+			counts[pass * buckets + ((k >> (pass * digitBits)) & mask)]++;
+		}
+	}
+
+	vector<T> buffer;
+	bool inBuffer = false;
+
+	const Key firstKey = RadixKey(key(*first));
+
+	for (unsigned pass = 0; pass < passes; pass++)
+	{
+		const unsigned shift = pass * digitBits;
+		size_t* offsets = counts.data() + pass * buckets;
+
+		//   ڸ  ٲ ʴ´.
+		if (offsets[(firstKey >> shift) & mask] == static_cast<size_t>(n))
+		{
+			continue;
+		}
+
+		size_t sum = 0;
+		for (size_t digit = 0; digit < buckets; digit++)
+		{
+			size_t count = offsets[digit];
+			offsets[digit] = sum;
+			sum += count;
+		}
+
+		if (buffer.empty())
+		{
+			buffer.resize(n);
+		}
+
+		if (inBuffer)
+		{
+			RadixScatter(buffer.begin(), buffer.end(), first, offsets, shift, mask, key);
+		}
+		else
+		{
+			RadixScatter(first, last, buffer.begin(), offsets, shift, mask, key);
+		}
+
+		inBuffer = inBuffer == false;
+	}
+
+	if (inBuffer)
+	{
+		std::move(buffer.begin(), buffer.end(), first);
+	}
+}
+
+template<typename Container, typename KeyFunc = RadixIdentity>
+auto RadixSort(Container& v, KeyFunc key = KeyFunc(), unsigned digitBits = 0) -> decltype(v.data(), void())
+{
+	RadixSort(v.data(), v.data() + v.size(), key, digitBits);
+}
+
+// ̺  Ŷ  
+constexpr ptrdiff_t AmericanFlagInsertionThreshold = 32;
+
+template<typename RandomIt, typename KeyFunc>
+void AmericanFlagSortLoop(RandomIt first, RandomIt last, KeyFunc& key, int shift)
+{
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+
+	constexpr size_t buckets = 256;
+
+	while (true)
+	{
+		const ptrdiff_t n = last - first;
+
+		if (n <= AmericanFlagInsertionThreshold)
+		{
+			InsertionSort(first, last, [&key](const T& a, const T& b) { return RadixKey(key(a)) < RadixKey(key(b)); });
+			return;
+		}
+
+		size_t counts[buckets] = {};
+
+		for (RandomIt it = first; it != last; ++it)
+		{
+			counts[(RadixKey(key(*it)) >> shift) & (buckets - 1)]++;
+		}
+
+		//   ڸ  ʿ   ڸ
+		if (counts[(RadixKey(key(*first)) >> shift) & (buckets - 1)] == static_cast<size_t>(n))
+		{
+			if (shift == 0)
+			{
+				return;
+			}
+
+			shift -= 8;
+			continue;
+		}
+
+		// next[d] ~ end[d] : d Ŷ  ڸ ã  
+		ptrdiff_t next[buckets];
+		ptrdiff_t end[buckets];
+		ptrdiff_t sum = 0;
+
+		for (size_t digit = 0; digit < buckets; digit++)
+		{
+			next[digit] = sum;
+			sum += static_cast<ptrdiff_t>(counts[digit]);
+			end[digit] = sum;
+		}
+
+		// Ҹ  ڱ Ŷ ,  ڸ ִ Ҹ ٽ    ݺѴ. (ȯ ġȯ)
+		for (size_t digit = 0; digit < buckets; digit++)
+		{
+			while (next[digit] < end[digit])
+			{
+				T value = std::move(first[next[digit]]);
+				size_t target = (RadixKey(key(value)) >> shift) & (buckets - 1);
+
+				while (target != digit)
+				{
+					std::swap(value, first[next[target]++]);
+					target = (RadixKey(key(value)) >> shift) & (buckets - 1);
+				}
+
+				first[next[digit]++] = std::move(value);
+			}
+		}
+
+		if (shift == 0)
+		{
+			return;
+		}
+
+		ptrdiff_t begin = 0;
+		for (size_t digit = 0; digit < buckets; digit++)
+		{
+			if (end[digit] - begin > 1)
+			{
+				AmericanFlagSortLoop(first + begin, first + end[digit], key, shift - 8);
+			}
+
+			begin = end[digit];
+		}
+
+		return;
+	}
+}
+
+// MSD   (American Flag Sort)
+//   8Ʈ ڸ 256 Ŷ ڸ   Ŷ  ڸ .
+// ۾  ʿ  ޸𸮰   LSD  .   ƴϴ.
+// O(N * ڸ ),  ̴ Ű Ʈ  
+template<typename RandomIt, typename KeyFunc = RadixIdentity>
+void AmericanFlagSort(RandomIt first, RandomIt last, KeyFunc key = KeyFunc())
+{
+	using Key = RadixKeyType<KeyFunc, typename std::iterator_traits<RandomIt>::value_type>;
+
+	if (last - first <= 1)
+	{
+		return;
+	}
+
+	AmericanFlagSortLoop(first, last, key, static_cast<int>(sizeof(Key) * 8) - 8);
+}
+
+template<typename Container, typename KeyFunc = RadixIdentity>
+auto AmericanFlagSort(Container& v, KeyFunc key = KeyFunc()) -> decltype(v.data(), void())
+{
+	AmericanFlagSort(v.data(), v.data() + v.size(), key);
+}
+
+//  (Selection)
+// ü  ʰ ʿ  Ҹ ڸ ´.
+
+// ̺ ū  ǥ  ǹ . (Floyd-Rivest)
+constexpr ptrdiff_t FloydRivestThreshold = 600;
+
+// [first + left, first + right] (  )  first + k ڸ  Ҹ ã´.
+// ū  k ֺ  ǥ   ͷ  k д.
+//   k°  ſ Ƿ   k ִ   ۾.    N + min(k, N - k)
+//  budget ѵ       O(NlogN) Ѵ.
+template<typename RandomIt, typename Compare>
+void FloydRivestSelect(RandomIt first, ptrdiff_t left, ptrdiff_t right, ptrdiff_t k, Compare comp, int budget)
+{
+	while (right - left + 1 > SmallSortThreshold<typename std::iterator_traits<RandomIt>::value_type, Compare>)
+	{
+		if (budget-- == 0)
+		{
+			HeapSort(first + left, first + right + 1, comp);
+			return;
+		}
+
+		const ptrdiff_t n = right - left + 1;
+
+		if (n > FloydRivestThreshold)
+		{
+			// ǥ ũ s, k ǥ ȿ ϴ ġ ߽ ǥ sdŭ  д.
+			const double i = static_cast<double>(k - left + 1);
+			const double z = std::log(static_cast<double>(n));
+			const double s = 0.5 * std::exp(2.0 * z / 3.0);
+			const double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2.0 ? -1.0 : 1.0);
+
+			ptrdiff_t sampleLeft = std::max(left, static_cast<ptrdiff_t>(k - i * s / n + sd));
+			ptrdiff_t sampleRight = std::min(right, static_cast<ptrdiff_t>(k + (n - i) * s / n + sd));
+
+			FloydRivestSelect(first, sampleLeft, sampleRight, k, comp, budget);
+			std::iter_swap(first + left, first + k);
+		}
+		else
+		{
+			ChoosePivot(first + left, first + right + 1, comp);
+		}
+
+		ptrdiff_t pivot = Partition(first + left, first + right + 1, comp) - first;
+
+		if (pivot == k)
+		{
+			return;
+		}
+
+		if (pivot < k)
+		{
+			left = pivot + 1;
+		}
+		else
+		{
+			right = pivot - 1;
+		}
+	}
+
+	SmallSort(first + left, first + right + 1, comp);
+}
+
+// nth ڸ     ,      , ڴ  ̻ ǰ Ѵ. (std::nth_element)
+//  O(N), ־ O(NlogN)
+template<typename RandomIt, typename Compare = std::less<>>
+void NthElement(RandomIt first, RandomIt nth, RandomIt last, Compare comp = Compare())
+{
+	if (last - first <= 1 || nth == last)
+	{
+		return;
+	}
+
+	FloydRivestSelect(first, 0, (last - first) - 1, nth - first, comp, 2 * Log2(static_cast<size_t>(last - first)) + 4);
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto NthElement(Container& v, size_t n, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	NthElement(v.data(), v.data() + n, v.data() + v.size(), comp);
+}
+
+// [first, middle)  տ  (middle - first)  ´.    ʴ´. (std::partial_sort)
+// k = middle - first   k¥   տ   ٲ ִ´. O(Nlogk), κ    ɷ.
+// k ũ NthElement k   װ͸ Ѵ. O(N + klogk)
+template<typename RandomIt, typename Compare = std::less<>>
+void PartialSort(RandomIt first, RandomIt middle, RandomIt last, Compare comp = Compare())
+{
+	const ptrdiff_t k = middle - first;
+	const ptrdiff_t n = last - first;
+
+	if (k <= 0)
+	{
+		return;
+	}
+
+	if (k * 16 >= n)
+	{
+		NthElement(first, middle, last, comp);
+		PdqSort(first, middle, comp);
+		return;
+	}
+
+	//  ڿ    
+	MakeHeap(first, middle, comp);
+
+	for (RandomIt it = middle; it != last; ++it)
+	{
+		if (comp(*it, *first))
+		{
+			std::iter_swap(it, first);
+			HeapSiftDown(first, 0, static_cast<size_t>(k), comp);
+		}
+	}
+
+	for (RandomIt end = middle; end - first > 1; --end)
+	{
+		PopHeap(first, end, comp);
+	}
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto PartialSort(Container& v, size_t k, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	PartialSort(v.data(), v.data() + std::min(k, static_cast<size_t>(v.size())), v.data() + v.size(), comp);
+}
+
+//  k (Top-K)
+//  ϳ  Ʈ  ū (Compare std::less ) k Ѵ.
+// ܵ      top ũ k PriorityQueue ΰ, ׺ ū   ٲ ִ´.
+// ޸ O(k),  ϳ O(logk).   κ top   ϰ .
+template<typename T, typename Compare = std::less<T>>
+class TopK
+{
+public:
+
+	// constructor
+
+	explicit TopK(size_t k, const Compare& compare = Compare())
+		: mCapacity(k)
+		, mCompare(compare)
+		, mQueue(Reversed{ compare })
+	{}
+
+	//
+
+	// Element access
+
+	// ܵ     . ̺ ũ   ͵ .
+	inline const T& top() const
+	{
+		return mQueue.top();
+	}
+
+	// ܵ  ū ͺ
+	std::vector<T> sorted() const
+	{
+		PriorityQueue<T, std::vector<T>, Reversed> queue(mQueue);
+		std::vector<T> result(queue.size());
+
+		for (size_t i = result.size(); i > 0; i--)
+		{
+			result[i - 1] = queue.top();
+			queue.pop();
+		}
+
+		return result;
+	}
+
+	//
+
+	// Capacity
+
+	inline bool empty() const
+	{
+		return mQueue.empty();
+	}
+
+	inline size_t size() const
+	{
+		return mQueue.size();
+	}
+
+	inline size_t capacity() const
+	{
+		return mCapacity;
+	}
+
+	//
+
+	// Modifiers
+
+	//  true
+	bool push(const T& value)
+	{
+		if (mQueue.size() < mCapacity)
+		{
+			mQueue.push(value);
+			return true;
+		}
+
+		if (mCapacity == 0 || mCompare(mQueue.top(), value) == false)
+		{
+			return false;
+		}
+
+		mQueue.pop();
+		mQueue.push(value);
+		return true;
+	}
+
+	template<typename InputIt>
+	void push(InputIt first, InputIt last)
+	{
+		for (; first != last; ++first)
+		{
+			push(*first);
+		}
+	}
+
+	inline void clear()
+	{
+		mQueue = PriorityQueue<T, std::vector<T>, Reversed>(Reversed{ mCompare });
+	}
+
+private:
+	//    top ǵ 񱳸 ´.
+	struct Reversed
+	{
+		Compare compare;
+
+		inline bool operator()(const T& a, const T& b) const
+		{
+			return compare(b, a);
+		}
+	};
+
+private:
+	size_t mCapacity;
+	Compare mCompare;
+	PriorityQueue<T, std::vector<T>, Reversed> mQueue;
+};
+
+//   (Stable Sort)
+// ٰ 񱳵Ǵ    Ѵ. (std::stable_sort)
+//  std::less ϸ LSD  ,  ܿ   .    ̴.
+
+template<typename T, typename Compare>
+constexpr bool StableRadixSortable = std::is_integral_v<T> && std::is_same_v<T, bool> == false && SortingNetworkAscending<T, Compare>;
+
+// ̺ ª    迭  ȴ   ĺ ũ.
+constexpr ptrdiff_t StableRadixSortThreshold = 64;
+
+template<typename RandomIt, typename Compare = std::less<>>
+void StableSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+	using T = typename std::iterator_traits<RandomIt>::value_type;
+
+	if constexpr (StableRadixSortable<T, Compare>)
+	{
+		if (last - first >= StableRadixSortThreshold)
+		{
+			RadixSort(first, last);
+			return;
+		}
+	}
+
+	TimSort(first, last, comp);
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto StableSort(Container& v, Compare comp = Compare()) -> decltype(v.data(), void())
+{
+	StableSort(v.data(), v.data() + v.size(), comp);
+}
+
+// ε  (ArgSort), Ű-  (SortByKey)
+//   (Ű)     Բ ġ  .
+// ArgSort    ϰ,  ApplyPermutation ġѴ. (Ű, )   ʴ´.
+
+// Ű  ġ
+template<typename Key>
+struct SortKeyIndex
+{
+	Key key;
+	size_t index;
+};
+
+// [first, last)    i°    ġ i°  ش.  ٲ ʴ´.
+// Ű ۰ 簡 θ (Ű, ġ)  ӵ 迭  Ѵ.
+// ġ ϸ      ĳ ̽ .
+//   (ڿ ) ġ ϰ   Ѵ.
+template<typename RandomIt, typename Compare = std::less<>>
+vector<size_t> ArgSort(RandomIt first, RandomIt last, Compare comp = Compare())
+{
+	using Key = typename std::iterator_traits<RandomIt>::value_type;
+
+	const size_t n = static_cast<size_t>(last - first);
+	vector<size_t> order(n);
+
+	if constexpr (std::is_trivially_copyable_v<Key> && sizeof(Key) <= 16)
+	{
+		vector<SortKeyIndex<Key>> pairs(n);
+
+		for (size_t i = 0; i < n; i++)
+		{
+			pairs[i] = { first[i], i };
+		}
+
+		bool sorted = false;
+
+		if constexpr (StableRadixSortable<Key, Compare>)
+		{
+			if (static_cast<ptrdiff_t>(n) >= StableRadixSortThreshold)
+			{
+				RadixSort(pairs.begin(), pairs.end(), [](const SortKeyIndex<Key>& pair) { return pair.key; });
+				sorted = true;
+			}
+		}
+
+		if (sorted == false)
+		{
+			TimSort(pairs.begin(), pairs.end(), [&comp](const SortKeyIndex<Key>& a, const SortKeyIndex<Key>& b) { return comp(a.key, b.key); });
+		}
+
+		for (size_t i = 0; i < n; i++)
+		{
+			order[i] = pairs[i].index;
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < n; i++)
+		{
+			order[i] = i;
+		}
+
+		TimSort(order.begin(), order.end(), [&comp, first](size_t a, size_t b) { return comp(first[a], first[b]); });
+	}
+
+	return order;
+}
+
+template<typename Container, typename Compare = std::less<>>
+auto ArgSort(const Container& v, Compare comp = Compare()) -> decltype(v.data(), vector<size_t>())
+{
+	return ArgSort(v.data(), v.data() + v.size(), comp);
+}
+
+// first[i]  first[order[i]] ٲ۴. order 0 ~ N-1     (ArgSort )
+// buffer    ǵ ´. Ҹ   ű.
+// Ŭ  ڸ ű  Ƴ,  ġ о   ġ   ־
+// ĳ ̽ ϳ ʷ Ͼ.  бⳢ  ̶ ̽  ξ .
+// buffer ȣϴ  غ ۾ .      ġ  ٽ .
+template<typename RandomIt>
+auto ApplyPermutation(RandomIt first, const vector<size_t>& order,
+	vector<typename std::iterator_traits<RandomIt>::value_type>& buffer) -> decltype(*first, void())
+{
+	const size_t n = order.size();
+
+	buffer.clear();
+	buffer.reserve(n);
+
+	for (size_t i = 0; i < n; i++)
+	{
+		buffer.push_back(std::move(first[order[i]]));
+	}
+
+	std::move(buffer.begin(), buffer.end(), first);
+}
+
+template<typename RandomIt>
+auto ApplyPermutation(RandomIt first, const vector<size_t>& order) -> decltype(*first, void())
+{
+	vector<typename std::iterator_traits<RandomIt>::value_type> buffer;
+	ApplyPermutation(first, order, buffer);
+}
+
+template<typename Container>
+auto ApplyPermutation(Container& v, const vector<size_t>& order) -> decltype(v.data(), void())
+{
+	assert(v.size() == order.size());
+
+	ApplyPermutation(v.data(), order);
+}
+
+// Ű [keyFirst, keyLast)  ϸ鼭  valueFirst   Բ ġѴ.
+//   ̸ ArgSort ApplyPermutation  .
+template<typename KeyIt, typename ValueIt, typename Compare = std::less<>>
+auto SortByKey(KeyIt keyFirst, KeyIt keyLast, ValueIt valueFirst, Compare comp = Compare()) -> decltype(*keyFirst, *valueFirst, void())
+{
+	const vector<size_t> order = ArgSort(keyFirst, keyLast, comp);
+
+	ApplyPermutation(keyFirst, order);
+	ApplyPermutation(valueFirst, order);
+}
+
+template<typename KeyContainer, typename ValueContainer, typename Compare = std::less<>>
+auto SortByKey(KeyContainer& keys, ValueContainer& values, Compare comp = Compare()) -> decltype(keys.data(), values.data(), void())
+{
+	assert(keys.size() == values.size());
+
+	SortByKey(keys.data(), keys.data() + keys.size(), values.data(), comp);
+}